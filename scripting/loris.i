@@ -93,6 +93,8 @@ For more information, please visit
 	//	import the entire Loris namespace
 	using namespace Loris;
 	
+	#include <algorithm>
+	#include <limits>
 	#include <stdexcept>
 	#include <vector>
 %}
@@ -178,6 +178,20 @@ zero-crossings) of the analysis window used by this Analyzer.");
  analysis, and false otherwise. (Default is true.)");
  
     bool phaseCorrect( void ) const;
+
+%feature("docstring",
+"Return the number of threads used to compute the spectral
+peaks of the analysis frames, or 0 if one thread per available
+processor is used. (Default is 1, a serial analysis.)");
+
+    unsigned int numThreads( void ) const;
+
+%feature("docstring",
+"Return true if the spectral analysis computes the windowed
+transforms as real-to-complex transforms, and false otherwise.
+(Default is false.)");
+
+    bool usesRealTransforms( void ) const;
     
 	
 %feature("docstring",
@@ -247,6 +261,23 @@ zero-crossings) of the analysis window used by this Analyzer.");
  analysis. (Default is true.)");
 
     void setPhaseCorrect( bool TF = true );
+
+%feature("docstring",
+"Set the number of threads used to compute the spectral peaks
+of the analysis frames, or 0 to use one thread per available
+processor. The analysis yields exactly the same Partials for 
+any number of threads. (Default is 1, a serial analysis.)");
+
+    void setNumThreads( unsigned int n );
+
+%feature("docstring",
+"Set whether the spectral analysis computes the four windowed
+transforms of each frame as real-to-complex transforms, instead
+of as pairs of real transforms packed into two complex transforms.
+Using FFTW, the spectral analysis is about a third faster. The 
+Partials are the same, up to round-off. (Default is false.)");
+
+    void setUseRealTransforms( bool TF = true );
     
     
 %feature("docstring",
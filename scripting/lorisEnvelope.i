@@ -37,21 +37,102 @@
 /* ******************** inserted C++ code ********************* */
 %{
 
-typedef LinearEnvelope::iterator LinearEnvelopePosition;
+/*	Envelope positions
+
+	LinearEnvelope iterators are invalidated by insertion of
+	breakpoints, because the breakpoints are stored in a vector, so 
+	the scripting interface must not hold on to them. As for the 
+	BreakpointPositions in a Partial, a LinearEnvelopePosition 
+	remembers its LinearEnvelope and the time of its breakpoint, and
+	looks up the breakpoint again every time it is used, and a 
+	SwigLinEnvIterator remembers the time of the last breakpoint it 
+	returned.
+*/
+static bool linenv_time_before( const LinearEnvelope::value_type & bp, double t )
+{
+	return bp.first < t;
+}
+
+struct LinearEnvelopePosition
+{
+	LinearEnvelope * subject;
+	double t;
+
+	LinearEnvelopePosition( LinearEnvelope & e, double time ) : 
+		subject( &e ), t( time ) {}
+	~LinearEnvelopePosition( void ) {}
+	
+	//	Return the current position of the breakpoint, or 
+	//	end() if it is no longer in the envelope.
+	LinearEnvelope::const_iterator find( void ) const
+	{
+		const LinearEnvelope & env = *subject;
+		LinearEnvelope::const_iterator pos = 
+			std::lower_bound( env.begin(), env.end(), t, linenv_time_before );
+		if ( pos != env.end() && pos->first != t )
+		{
+			pos = env.end();
+		}
+		return pos;
+	}
+	
+	double time( void ) const { return t; }
+	
+	double value( void ) const
+	{
+		LinearEnvelope::const_iterator pos = find();
+		if ( pos == static_cast< const LinearEnvelope * >( subject )->end() )
+		{
+			Throw( Loris::InvalidIterator, 
+				   "LinearEnvelopePosition refers to a breakpoint that was removed from its envelope." );
+		}
+		return pos->second;
+	}
+	
+	void setValue( double x )
+	{
+		//	check that the breakpoint is still there, then
+		//	replace its value:
+		value();
+		subject->insert( t, x );
+	}
+};
  
 struct SwigLinEnvIterator
 {
 	LinearEnvelope & subject;
-	LinearEnvelopePosition it;
+	double t;
+	bool pastT;
 
-	SwigLinEnvIterator( LinearEnvelope & l ) : subject( l ), it ( l.begin() ) {}
+	//	Start at the first breakpoint in the envelope, or at
+	//	the specified LinearEnvelopePosition.
+	SwigLinEnvIterator( LinearEnvelope & l ) : 
+		subject( l ), t( - std::numeric_limits< double >::max() ), pastT( false ) {}
 	
-	SwigLinEnvIterator( LinearEnvelope & l, LinearEnvelope::iterator i ) : 
-		subject( l ), it ( i ) {}
+	SwigLinEnvIterator( LinearEnvelope & l, const LinearEnvelopePosition & start ) : 
+		subject( l ), t( start.time() ), pastT( false ) {}
 		
 	~SwigLinEnvIterator( void ) {}
 	
-	bool atEnd( void ) { return it == subject.end(); }
+	//	Return the position of the first breakpoint at or after
+	//	time t, or strictly after t once a breakpoint at t has 
+	//	been returned.
+	LinearEnvelope::const_iterator position( void ) const
+	{
+		const LinearEnvelope & env = subject;
+		LinearEnvelope::const_iterator it = 
+			std::lower_bound( env.begin(), env.end(), t, linenv_time_before );
+		if ( pastT && it != env.end() && it->first == t )
+		{
+			++it;
+		}
+		return it;
+	}
+	
+	bool atEnd( void ) 
+	{ 
+		return position() == static_cast< const LinearEnvelope & >( subject ).end(); 
+	}
 	bool hasNext( void ) { return !atEnd(); }
 
 	LinearEnvelopePosition * next( void )
@@ -61,9 +142,9 @@ struct SwigLinEnvIterator
 			throw_exception("end of LinearEnvelope");
 			return 0;
 		}
-		LinearEnvelopePosition * ret = new LinearEnvelopePosition(it);
-		++it;
-		return ret;
+		t = position()->first;
+		pastT = true;
+		return new LinearEnvelopePosition( subject, t );
 	}
 };
 
@@ -286,7 +367,7 @@ for the new iterator.") iterator;
 		return new SwigLinEnvIterator(*self);
 	}
 	
-	SwigLinEnvIterator * iterator( LinearEnvelope::iterator * startHere )
+	SwigLinEnvIterator * iterator( LinearEnvelopePosition * startHere )
 	{
 		return new SwigLinEnvIterator(*self, *startHere );
 	}
@@ -332,7 +413,7 @@ LinearEnvelopePosition.") time;
 	
 		double time( void ) const 
 		{
-			return (*self)->first;
+			return self->time();
 		}
 		
 %feature("docstring",
@@ -341,7 +422,7 @@ LinearEnvelopePosition.") value;
 
 		double value( void ) const
 		{
-			return (*self)->second;
+			return self->value();
 		}
 		
 %feature("docstring",
@@ -350,7 +431,7 @@ LinearEnvelopePosition.") setValue;
 
 		void setValue( double x )
 		{
-			(*self)->second = x;
+			self->setValue( x );
 		}
 	}
 	
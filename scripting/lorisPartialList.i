@@ -43,6 +43,10 @@
 %newobject Partial::iterator;
 %newobject PartialList::iterator;
 
+%newobject Partial::first;
+%newobject Partial::last;
+%newobject BreakpointPosition::breakpoint;
+
 %newobject *::findAfter;
 %newobject *::findNearest;
 	
@@ -86,30 +90,93 @@ struct SwigPListIterator
 	}
 };
 
-typedef Partial::iterator BreakpointPosition;
+/*	Breakpoint positions
+
+	Partial::iterators are invalidated by insertion and removal of
+	Breakpoints, because the Breakpoints are stored in a vector 
+	(unless Loris is built with LORIS_PARTIAL_MAP), so the scripting
+	interface must not hold on to them. A BreakpointPosition remembers
+	its Partial and the time of its Breakpoint instead, and looks up 
+	the Breakpoint again every time it is used. Similarly, a
+	SwigPartialIterator remembers the time of the last Breakpoint
+	it returned.
+*/
+struct BreakpointPosition
+{
+	Partial * subject;
+	double t;
+
+	BreakpointPosition( Partial & p, Partial::iterator pos ) : 
+		subject( &p ), t( pos.time() ) {}
+	~BreakpointPosition( void ) {}
+	
+	//	Return the current position of the Breakpoint, or 
+	//	end() if it is no longer in the Partial.
+	Partial::iterator find( void ) const
+	{
+		Partial::iterator pos = subject->findAfter( t );
+		if ( pos != subject->end() && pos.time() != t )
+		{
+			pos = subject->end();
+		}
+		return pos;
+	}
+	
+	double time( void ) const { return t; }
+	
+	Breakpoint & breakpoint( void ) const
+	{
+		Partial::iterator pos = find();
+		if ( pos == subject->end() )
+		{
+			Throw( Loris::InvalidIterator, 
+				   "BreakpointPosition refers to a Breakpoint that was removed from its Partial." );
+		}
+		return pos.breakpoint();
+	}
+};
 
 struct SwigPartialIterator
 {
 	Partial & subject;
-	Partial::iterator it;
-
-	SwigPartialIterator( Partial & p ) : subject( p ), it ( p.begin() ) {}
-	SwigPartialIterator( Partial & p, Partial::iterator i ) : subject( p ), it ( i ) {}
+	double t;
+	bool pastT;
+
+	//	Start at the first Breakpoint in the Partial, or at
+	//	the specified BreakpointPosition.
+	SwigPartialIterator( Partial & p ) : 
+		subject( p ), t( - std::numeric_limits< double >::max() ), pastT( false ) {}
+	SwigPartialIterator( Partial & p, const BreakpointPosition & start ) : 
+		subject( p ), t( start.time() ), pastT( false ) {}
 	~SwigPartialIterator( void ) {}
 	
-	bool atEnd( void ) { return it == subject.end(); }
+	//	Return the position of the first Breakpoint at or after
+	//	time t, or strictly after t once a Breakpoint at t has 
+	//	been returned.
+	Partial::iterator position( void )
+	{
+		Partial::iterator it = subject.findAfter( t );
+		if ( pastT && it != subject.end() && it.time() == t )
+		{
+			++it;
+		}
+		return it;
+	}
+	
+	bool atEnd( void ) { return position() == subject.end(); }
 	bool hasNext( void ) { return !atEnd(); }
 
 	BreakpointPosition * next( void )
 	{
-		if ( atEnd() )
+		Partial::iterator it = position();
+		if ( it == subject.end() )
 		{
 			throw_exception("end of Partial");
 			return 0;
 		}
-		BreakpointPosition * ret = new BreakpointPosition(it);
-		++it;
-		return ret;
+		t = it.time();
+		pastT = true;
+		return new BreakpointPosition( subject, it );
 	}
 };
 
@@ -956,15 +1023,27 @@ Partial.") remove;
 
 		void remove( BreakpointPosition * pos )
 		{
-			if ( *pos != self->end() )
+			if ( pos->subject != self )
+			{
+				Throw( Loris::InvalidArgument, 
+					   "BreakpointPosition does not refer to this Partial." );
+			}
+			Partial::iterator it = pos->find();
+			if ( it == self->end() )
 			{
-				*pos = self->erase( *pos );
+				Throw( Loris::InvalidArgument, 
+					   "BreakpointPosition refers to a Breakpoint that is not in this Partial." );
+			}
+			it = self->erase( it );
+			if ( it != self->end() )
+			{
+				pos->t = it.time();
 			}
 		}
 
 %feature("docstring",
-"Return the first Breakpoint this Partial, or 0 if this
-Partial is empty.") first;
+"Return a copy of the first Breakpoint this Partial, or 0 if
+this Partial is empty.") first;
 
         Breakpoint * first( void )
         {
@@ -974,13 +1053,13 @@ Partial is empty.") first;
             }
             else
             {
-                return &( self->first() );
+                return new Breakpoint( self->first() );
             }
         }
 
 %feature("docstring",
-"Return the last Breakpoint this Partial, or 0 if this
-Partial is empty.") last;
+"Return a copy of the last Breakpoint this Partial, or 0 if
+this Partial is empty.") last;
 
         Breakpoint * last( void )
         {
@@ -990,7 +1069,7 @@ Partial is empty.") last;
             }
             else
             {
-                return &( self->last() );
+                return new Breakpoint( self->last() );
             }
         }
 
@@ -1014,10 +1093,10 @@ findAfter;
 
 		BreakpointPosition * findAfter( double time )
 		{
-			BreakpointPosition p = self->findAfter( time );
+			Partial::iterator p = self->findAfter( time );
 			if ( p != self->end() )
 			{
-				return new BreakpointPosition( p );
+				return new BreakpointPosition( *self, p );
 			}
 			else
 			{
@@ -1028,11 +1107,19 @@ findAfter;
 %feature("docstring",
 "Return a BreakpointPosition positioned at
 the Breakpoint in this Partial that is nearest to the
-specified time.") findNearest;
+specified time, or nothing if this Partial is empty.") findNearest;
 
 		BreakpointPosition * findNearest( double time )
 		{
-			return new BreakpointPosition( self->findNearest( time ) );
+			Partial::iterator p = self->findNearest( time );
+			if ( p != self->end() )
+			{
+				return new BreakpointPosition( *self, p );
+			}
+			else
+			{
+				return NULL;
+			}
 		}
 	}		
 };
@@ -1145,12 +1232,13 @@ BreakpointPosition.") time;
 		}
 
 %feature("docstring",
-"Return the Breakpoint (not a copy!) at this
-BreakpointPosition.") breakpoint;
+"Return a copy of the Breakpoint at this BreakpointPosition.
+Use the BreakpointPosition to modify the Breakpoint in its
+Partial.") breakpoint;
 
 		Breakpoint * breakpoint( void ) 
 		{ 
-			return &(self->breakpoint());
+			return new Breakpoint( self->breakpoint() );
 		}
 		
 		//	duplicate the Breakpoint interface:
@@ -254,6 +254,64 @@ public:
     PartialList analyze( const double * bufBegin, const double * bufEnd, double srate,
                   const Envelope & reference );
     
+//  -- streaming analysis --
+
+    //! Begin analyzing a stream of (mono) samples at the given sample 
+    //! rate (in Hz), delivered in pieces of any size by pushSamples.
+    //! Only the samples needed by analysis frames that have not yet
+    //! been computed are retained, so the memory used for samples does
+    //! not grow with the length of the stream. The analysis results do
+    //! grow: Partials are retained until they are drained, and the
+    //! amplitude and fundamental frequency envelopes (see ampEnv and
+    //! fundamentalEnv) gain a point for every analysis frame, for the
+    //! whole stream. Partials that can no longer be 
+    //! extended are retrieved using drainFinishedPartials, and the 
+    //! remaining Partials are returned by endStream. Together, these 
+    //! are exactly the Partials that analyze would extract from the 
+    //! whole stream (but not in the same order).
+    //!
+    //! Any stream already in progress is abandoned. The analysis 
+    //! parameters must not be changed until the stream is ended.
+    //! 
+    //! \param  srate is the sample rate of the samples in the stream
+    void beginStream( double srate );
+    
+    //! Begin analyzing a stream of (mono) samples at the given sample 
+    //! rate (in Hz), as beginStream( srate ), and use the specified 
+    //! envelope as a frequency reference for Partial tracking.
+    //! 
+    //! \param  srate is the sample rate of the samples in the stream
+    //! \param  reference is an Envelope having the approximate
+    //!         frequency contour expected of the resulting Partials.
+    void beginStream( double srate, const Envelope & reference );
+    
+    //! Append a range of (mono) samples to the stream begun by 
+    //! beginStream, and compute every analysis frame whose window
+    //! is covered by the samples received so far.
+    //! 
+    //! \param  bufBegin is a pointer to a buffer of floating point samples
+    //! \param  bufEnd is (one-past) the end of a buffer of floating point 
+    //!         samples
+    //! \throw  InvalidObject if no stream is in progress.
+    void pushSamples( const double * bufBegin, const double * bufEnd );
+    
+    //! Return the Partials in the stream that can no longer be extended
+    //! by subsequent samples, and that have not already been returned.
+    //! 
+    //! \throw  InvalidObject if no stream is in progress.
+    PartialList drainFinishedPartials( void );
+    
+    //! End the stream begun by beginStream, computing the analysis
+    //! frames at the end of the stream, and return the Partials that 
+    //! have not already been returned by drainFinishedPartials.
+    //! 
+    //! \throw  InvalidObject if no stream is in progress.
+    PartialList endStream( void );
+    
+    //! Return true if a stream begun by beginStream has not yet 
+    //! been ended, and false otherwise.
+    bool isStreaming( void ) const { return 0 != m_stream.get(); }
+    
 //  -- parameter access --
 
     //! Return the amplitude floor (lowest detected spectral amplitude),            
@@ -305,6 +363,16 @@ public:
     //! analysis, and false otherwise. (Default is true.)
     bool phaseCorrect( void ) const;
 
+    //! Return the number of threads used to compute the spectral
+    //! peaks of the analysis frames, or 0 if one thread per available
+    //! processor is used. (Default is 1, a serial analysis.)
+    unsigned int numThreads( void ) const;
+
+    //! Return true if the spectral analysis computes the windowed
+    //! transforms as real-to-complex transforms (see 
+    //! setUseRealTransforms), and false otherwise. (Default is false.)
+    bool usesRealTransforms( void ) const;
+
 
 //  -- parameter mutation --
 
@@ -377,6 +445,29 @@ public:
     //! \param  TF is a flag indicating whether or not to construct
     //!         phase-corrected Partials
     void setPhaseCorrect( bool TF = true );
+
+    //! Set the number of threads used to compute the spectral peaks
+    //! of the analysis frames. Each thread owns its own reassigned
+    //! spectrum, and the peaks of several frames are computed 
+    //! concurrently, but Partials are always formed from the peaks
+    //! in frame order, so the analysis yields exactly the same Partials 
+    //! and envelopes for any number of threads. (Default is 1, a serial 
+    //! analysis.)
+    //!
+    //! \param  n is the number of threads to use, or 0 to use
+    //!         one thread per available processor.
+    void setNumThreads( unsigned int n );
+
+    //! Set whether the spectral analysis computes the four windowed
+    //! transforms of each frame as real-to-complex transforms, instead
+    //! of as pairs of real transforms packed into two complex transforms
+    //! (see ReassignedSpectrum). Using FFTW, the spectral analysis of a
+    //! frame is about a third faster using real transforms. The Partials
+    //! are the same, up to round-off. (Default is false.)
+    //!
+    //! \param  TF is a flag indicating whether or not to use
+    //!         real-to-complex transforms
+    void setUseRealTransforms( bool TF = true );
     
     
 //  -- bandwidth envelope specification --
@@ -549,6 +640,12 @@ private:
                                 
     bool m_phaseCorrect;        //!  flag indicating that phases/frequencies should be
                                 //!  made consistent at the end of the analysis
+
+    unsigned int m_numThreads;  //!  number of threads used to compute spectral peaks,
+                                //!  0 to use one per processor
+                                
+    bool m_useRealTransforms;   //!  flag indicating that the spectral analysis uses
+                                //!  real-to-complex transforms
                             
         
     //! builder object for constructing a fundamental frequency
@@ -559,6 +656,11 @@ private:
     //! estimate during analysis
     std::auto_ptr< LinearEnvelopeBuilder > m_ampEnvBuilder;
 
+    //! state of the streaming analysis in progress, if any,
+    //! not copied or assigned
+    class Stream;
+    std::auto_ptr< Stream > m_stream;
+
 //  -- private auxiliary functions --
 //	future development
 /*
@@ -598,7 +700,7 @@ private:
     //  Rejected peaks are placed at the end of the peak collection.
     //  Return the first position in the collection containing a rejected peak,
     //  or the end of the collection if no peaks are rejected.
-    Peaks::iterator thinPeaks( Peaks & peaks, double frameTime  );
+    Peaks::iterator thinPeaks( Peaks & peaks, double frameTime  ) const;
                 
     //  Fix the bandwidth value stored in the specified Peaks. 
     //  This function is invoked if the spectral residue method is
@@ -607,7 +709,24 @@ private:
     //  compute bandwidth, the appropriate scaling is applied
     //  to the stored mixed phase derivative. Otherwise, the
     //  Peak bandwidth is set to zero.
-    void fixBandwidth( Peaks & peaks );
+    void fixBandwidth( Peaks & peaks ) const;
+    
+    //  Build the Kaiser analysis window and its time derivative for the 
+    //  specified sample rate, and return the window length, always odd.
+    long buildWindows( double srate, std::vector< double > & window, 
+                       std::vector< double > & windowDeriv ) const;
+    
+    //  Return the hop size in samples (truncated) for the specified 
+    //  sample rate.
+    //
+    //  \throw InvalidObject if the hop time is shorter than one sample.
+    long hopSamples( double srate ) const;
+
+    //  Helper class for computing the thinned spectral peaks in a block
+    //  of analysis frames using several threads, defined in Analyzer.C.
+    class FrameTask;
+    friend class FrameTask;
+    friend class Stream;
                     
 };  //  end of class Analyzer
 
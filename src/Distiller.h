@@ -71,6 +71,8 @@ class Distiller
 //  -- instance variables --
 
     double _fadeTime, _gapTime;         // distillation parameters
+    unsigned int _numThreads;           // number of threads used to distill
+                                        // label groups, or 0 for one per processor
         
 //  -- public interface --
 public:
@@ -122,6 +124,23 @@ public:
      
     //  Use compiler-generated copy, assign, and destroy.
     
+//  -- access/mutation --
+
+    //! Return the number of threads used to distill groups of Partials
+    //! having a common label, or 0 if one thread per available processor
+    //! is used. (Default is 1, serial distillation.)
+    unsigned int numThreads( void ) const;
+    
+    //! Set the number of threads used to distill groups of Partials
+    //! having a common label. The groups are independent, so they are
+    //! distilled concurrently, and the distilled Partials are assembled
+    //! in label order, exactly as they are when a single thread is
+    //! used. (Default is 1, serial distillation.)
+    //!
+    //! \param  n is the number of threads to use, or 0 to use
+    //!         one thread per available processor.
+    void setNumThreads( unsigned int n );
+    
 //  -- distillation --
 
     //! Distill labeled Partials in a collection leaving only a single 
@@ -233,7 +252,12 @@ private:
     //!	Distill a list of Partials into a single Partial and return it.
     //! If an empty list of Partials is passed, then an empty Partial
     //! is returned.
-    Partial distillOne( PartialList & partials );                        
+    Partial distillOne( PartialList & partials ) const;
+    
+    //! ParallelTask used by distill_list to distill groups of Partials
+    //! having a common label using several threads.
+    class DistillTask;
+    friend class DistillTask;
     
 };  //  end of class Distiller
 
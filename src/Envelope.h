@@ -73,6 +73,22 @@ public:
 
 	//!	Return the value of this Envelope at the specified time. 	 
 	virtual double valueAt( double x ) const = 0;	
+
+	//!	Store in values the values of this Envelope at the n
+	//!	specified times, that is, values[k] = valueAt( times[k] ).
+	//!	The default implementation calls valueAt once per time.
+	//!	Derived classes may override it to evaluate many times 
+	//!	with a single virtual call, and to evaluate non-decreasing
+	//!	sequences of times, the usual case, more efficiently
+	//!	(times need not be sorted, however).
+	//!
+	//!	\param	times is the array of n times at which to evaluate
+	//!			this Envelope.
+	//!	\param	values is the array of (at least) n values in which
+	//!			to store the results, and may be the same array
+	//!			as times.
+	//!	\param	n is the number of times to evaluate.
+	virtual void valuesAt( const double * times, double * values, long n ) const;
 	
 };	//	end of abstract class Envelope
 
@@ -133,6 +149,18 @@ public:
 	{
 		return m_offset + ( m_scale * m_env->valueAt( x ) );
 	}
+
+	//!	Store in values the values of this Envelope at the n
+	//!	specified times, evaluating the wrapped Envelope with 
+	//!	a single call.
+	virtual void valuesAt( const double * times, double * values, long n ) const
+	{
+		m_env->valuesAt( times, values, n );
+		for ( long k = 0; k < n; ++k )
+		{
+			values[k] = m_offset + ( m_scale * values[k] );
+		}
+	}
 	
 //  -- private member variables --
 
@@ -39,7 +39,6 @@
 #include "Notifier.h"
 
 #include <algorithm>
-#include <deque>
 #include <vector>
 
 //  begin namespace
@@ -66,11 +65,14 @@ namespace Loris {
 //! G is the additional filter gain, and is unity if unspecified.
 //!
 //!
-//! Filter is implemented using a std::deque to store the filter state, 
-//! and relies on the efficiency of that class. If deque is not implemented
-//! using some sort of circular buffer (as it should be -- deque is guaranteed
-//! to be efficient for repeated insertion and removal at both ends), then
-//! this filter class will be slow.
+//! Filter stores its state in a fixed-size circular buffer, so no 
+//! memory is allocated or moved when filtering. Third order filters
+//! (having four feed-forward and four feedback coefficients), like the 
+//! filter applied to the noise modulating bandwidth-enhanced oscillators,
+//! are filtered by a specialized loop that keeps the state in local 
+//! variables, and produces exactly the same output as the general one. 
+//! Whole buffers of samples can be filtered at once, saving the overhead 
+//! of a function call per sample.
 //
 class Filter
 {
@@ -134,6 +136,19 @@ public:
     //! \return the next output sample
     double apply( double input );
 
+    //! Filter a buffer of samples. Compute filtered samples from
+    //! the input samples in the half-open range [begin, end) and 
+    //! store them in the buffer starting at output, which may be 
+    //! the same as begin (but must not otherwise overlap the input).
+    //! The output is the same as would be computed by calling
+    //! apply( double ) for each input sample in turn.
+    //!
+    //! \param begin is the beginning of the range of input samples
+    //! \param end is the end of the range of input samples
+    //! \param output is the beginning of the range of output samples,
+    //!        must have room for end - begin samples
+    void apply( const double * begin, const double * end, double * output );
+
     //! Function call operator, same as sample().
     //!
     //! \sa apply
@@ -174,8 +189,13 @@ private:
     
 //  --- implementation ---
 
-    //! single delay line for Direct-Form II implementation
-    std::deque< double > m_delayline;
+    //! single delay line for Direct-Form II implementation, a circular
+    //! buffer stored twice in succession, so that the most recent values,
+    //! newest first, are always contiguous, starting at m_newest
+    std::vector< double > m_delayline;
+    
+    //! position of the most recent value in the delay line
+    std::vector< double >::size_type m_newest;
         
     //! feed-forward coefficients
     std::vector< double > m_ffwdcoefs;  
@@ -186,6 +206,15 @@ private:
     //! filter gain (applied to output)
     double m_gain;      
 
+//  --- helpers ---
+
+    //! Filter a buffer of samples using a filter of any order.
+    void applyAnyOrder( const double * begin, const double * end, double * output );
+    
+    //! Filter a buffer of samples using a third order filter, having
+    //! four feed-forward and four feedback coefficients.
+    void applyThirdOrder( const double * begin, const double * end, double * output );
+
 };  //  end of class Filter
 
 
@@ -221,7 +250,8 @@ Filter::Filter( const double * ffwdbegin, const double * ffwdend, //    feed-for
 #endif
     m_ffwdcoefs( ffwdbegin, ffwdend ),
     m_fbackcoefs( fbackbegin, fbackend ),
-    m_delayline( std::max( ffwdend-ffwdbegin, fbackend-fbackbegin ) - 1, 0. ),
+    m_delayline( 2 * std::max( ffwdend-ffwdbegin, fbackend-fbackbegin ), 0. ),
+    m_newest( 0 ),
     m_gain( gain )
 {
     if ( *fbackbegin == 0. )
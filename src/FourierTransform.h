@@ -24,9 +24,10 @@
  *
  * FourierTransform.h
  *
- * Definition of class Loris::FourierTransform, providing a simplified
- * uniform interface to the FFTW library (www.fftw.org), version 2.1.3
- * or newer (including version 3), or to the General Purpose FFT package
+ * Definition of classes Loris::FourierTransform and
+ * Loris::RealFourierTransform, providing a simplified
+ * uniform interface to the FFTW library (www.fftw.org), version 3, 
+ * or to the General Purpose FFT package
  * by Takuya OOURA, http://momonga.t.u-tokyo.ac.jp/~ooura/fft.html if
  * FFTW is unavailable. 
  *
@@ -37,6 +38,7 @@
  *
  */
 #include <complex>
+#include <string>
 #include <vector>
 
 //	begin namespace
@@ -60,8 +62,16 @@ class FTimpl;
 //! as well. Uses the standard library complex class, which implements
 //! arithmetic operations. 
 //!
-//! Supports FFTW versions 2 and 3.
-//! Does not make use of FFTW "wisdom" to speed up transform computation.
+//! Supports FFTW version 3.
+//!
+//! The transform buffer is allocated by the transform implementation
+//! (using fftw_malloc, if FFTW is used), and the transform is computed 
+//! in that buffer, without copying. Plans (and, without FFTW, tables of
+//! twiddle factors) are shared by all transforms of the same size, in a 
+//! process-wide cache, so constructing many transforms of the same size
+//! is inexpensive. The planning effort can be configured, and using 
+//! FFTW, FFTW "wisdom" can be loaded from and saved to a file,
+//! to avoid repeating expensive planning in every process.
 //!
 //! If FFTW is unavailable, uses instead the General Purpose FFT package
 //! by Takuya OOURA, http://momonga.t.u-tokyo.ac.jp/~ooura/fft.html defined
@@ -78,10 +88,16 @@ public:
     typedef std::vector< std::complex< double > >::size_type size_type;
 
     //! The type of a non-const iterator of (complex) transform samples.
-    typedef std::vector< std::complex< double > >::iterator iterator;
+    typedef std::complex< double > * iterator;
 
     //! The type of a const iterator of (complex) transform samples.		
-    typedef std::vector< std::complex< double > >::const_iterator const_iterator;
+    typedef const std::complex< double > * const_iterator;
+
+    //! The amount of effort spent planning new transforms, using FFTW.
+    //! Estimate (the default) plans quickly, using heuristics. Measure 
+    //! and Patient time many candidate algorithms, so plans are made much
+    //! more slowly, but transforms may be computed faster.
+    enum PlanningEffort { Estimate, Measure, Patient };
 
 //	--- lifecycle ---
 
@@ -155,7 +171,7 @@ public:
     //!         in the transform buffer. 
     iterator begin( void )	
     { 
-        return _buffer.begin(); 
+        return _buffer; 
     }
 	
     //! Return an iterator refering to the end of the sequence of
@@ -165,7 +181,7 @@ public:
     //!         position in the transform buffer. 
     iterator end( void )	
     { 
-        return _buffer.end(); 
+        return _buffer + _size; 
     }
 
     //! Return a const iterator refering to the beginning of the sequence of
@@ -175,7 +191,7 @@ public:
     //!         in the transform buffer. 
     const_iterator begin( void ) const	
     { 
-        return _buffer.begin(); 
+        return _buffer; 
     }
 	
     //! Return a const iterator refering to the end of the sequence of
@@ -185,7 +201,7 @@ public:
     //!         position in the transform buffer. 
     const_iterator end( void ) const 	
     { 
-        return _buffer.end(); 
+        return _buffer + _size; 
     }
 
 //	--- operations ---
@@ -202,21 +218,216 @@ public:
     //! 
     //! \return the length of the transform in samples.
     size_type size( void ) const ;
+
+//	--- planning ---
+
+    //! Return the amount of effort spent planning new transforms.
+    static PlanningEffort planningEffort( void );
+
+    //! Set the amount of effort spent planning new transforms.
+    //! Transforms already planned (of any size that has been 
+    //! constructed using the previous effort) are not replanned.
+    //!
+    //! \param  effort is the new planning effort
+    static void setPlanningEffort( PlanningEffort effort );
+
+    //! Import FFTW wisdom from the specified file, so that plans 
+    //! made subsequently can benefit from the planning done in an
+    //! earlier process. Wisdom should be loaded before constructing
+    //! any transforms. Has no effect unless Loris uses FFTW.
+    //!
+    //! \param  path is the name of the wisdom file
+    //! \return true if wisdom was imported, false if the file could
+    //!         not be read or did not contain valid wisdom, or if 
+    //!         FFTW is not used
+    static bool loadWisdom( const std::string & path );
+
+    //! Export the FFTW wisdom accumulated by planning transforms 
+    //! (including wisdom previously loaded) to the specified file. 
+    //! Has no effect unless Loris uses FFTW.
+    //!
+    //! \param  path is the name of the wisdom file
+    //! \throw  FileIOException if the file cannot be written.
+    static void saveWisdom( const std::string & path );
                 
 //	-- instance variables --
 private:
 
-    //! buffer containing the complex transform input before
-    //! computing the transform, and the complex transform output
-    //! after computing the transform
-    std::vector< std::complex< double > > _buffer;
-
     // insulating implementation instance (defined in 
     // FourierTransform.C), conceals interface to FFTW
     FTimpl * _impl;
 
+    //! buffer (owned by _impl) containing the complex transform 
+    //! input before computing the transform, and the complex 
+    //! transform output after computing the transform
+    std::complex< double > * _buffer;
+
+    //! the length of the transform
+    size_type _size;
+
 };	//	end of class FourierTransform
 
+//  insulating implementation class, defined in FourierTransform.C
+class RFTimpl;
+
+// ---------------------------------------------------------------------------
+//	class RealFourierTransform
+//
+//! RealFourierTransform computes the Fourier transform of a sequence of
+//! real samples. The transform of real samples is conjugate-symmetric,
+//! so only its first half, the N/2 + 1 complex samples from zero
+//! frequency to the Nyquist frequency (inclusive), is computed and
+//! stored. The remaining samples are the complex conjugates of these,
+//! X[N-k] = conj( X[k] ).
+//!
+//! Unlike FourierTransform, the transform is not computed in-place.
+//! Real samples are stored in the RealFourierTransform instance using
+//! iterator access, the transform is computed by the transform member,
+//! and the complex transform samples are accessed by subscript. As for
+//! FourierTransform, the buffers are allocated by the implementation,
+//! and plans are shared by all transforms of the same size.
+//!
+//! Uses the real-to-complex transforms in FFTW version 3. If FFTW is
+//! unavailable, uses the real transform in the General Purpose FFT
+//! package (fftsg.c) for power-of-two transforms. Otherwise, the 
+//! transform is computed as a complex transform having zero imaginary
+//! part.
+//
+class RealFourierTransform
+{
+//	-- public interface --
+public:
+
+    //! An unsigned integral type large enough
+    //! to represent the length of any transform.
+    typedef std::vector< double >::size_type size_type;
+
+    //! The type of a non-const iterator of (real) input samples.
+    typedef double * iterator;
+
+    //! The type of a const iterator of (real) input samples.
+    typedef const double * const_iterator;
+
+//	--- lifecycle ---
+
+    //! Initialize a new RealFourierTransform of the specified size.
+    //!
+    //! \param  len is the length of the transform in samples (the
+    //!         number of real samples in the transform)
+    //! \throw  RuntimeError if the necessary buffers cannot be
+    //!         allocated, or there is an error configuring FFTW.
+    RealFourierTransform( size_type len );
+
+    //! Initialize a new RealFourierTransform that is a copy of another,
+    //! having the same size and the same buffer contents.
+    //!
+    //! \param  rhs is the instance to copy
+    //! \throw  RuntimeError if the necessary buffers cannot be
+    //!         allocated, or there is an error configuring FFTW.
+    RealFourierTransform( const RealFourierTransform & rhs );
+
+    //! Free the resources associated with this RealFourierTransform.
+    ~RealFourierTransform( void );
+
+//	--- operators ---
+
+    //! Make this RealFourierTransform a copy of another, having
+    //! the same size and buffer contents.
+    //!
+    //! \param  rhs is the instance to copy
+    //! \return a reference to this instance
+    //! \throw  RuntimeError if the necessary buffers cannot be
+    //!         allocated, or there is an error configuring FFTW.
+    RealFourierTransform & operator= ( const RealFourierTransform & rhs );
+
+//	--- access/mutation ---
+
+    //! Access (read-only) a complex transform sample by index.
+    //! Use this member to access the samples after computing
+    //! the transform. (inlined for speed)
+    //!
+    //! \param  index is the index or rank of the complex
+    //!         transform sample to access, on the range [0, size()/2].
+    //! \return const reference to the std::complex< double >
+    //!         at the specified position in the transform.
+    const std::complex< double > & operator[] ( size_type index ) const
+    {
+        return _output[ index ];
+    }
+
+    //! Return an iterator refering to the beginning of the sequence of
+    //! real samples in the transform input buffer.
+    //!
+    //! \return a non-const iterator refering to the first position
+    //!         in the transform input buffer.
+    iterator begin( void )
+    {
+        return _input;
+    }
+
+    //! Return an iterator refering to the end of the sequence of
+    //! real samples in the transform input buffer.
+    //!
+    //! \return a non-const iterator refering to one past the last
+    //!         position in the transform input buffer.
+    iterator end( void )
+    {
+        return _input + _size;
+    }
+
+    //! Return a const iterator refering to the beginning of the sequence of
+    //! real samples in the transform input buffer.
+    //!
+    //! \return a const iterator refering to the first position
+    //!         in the transform input buffer.
+    const_iterator begin( void ) const
+    {
+        return _input;
+    }
+
+    //! Return a const iterator refering to the end of the sequence of
+    //! real samples in the transform input buffer.
+    //!
+    //! \return a const iterator refering to one past the last
+    //!         position in the transform input buffer.
+    const_iterator end( void ) const
+    {
+        return _input + _size;
+    }
+
+//	--- operations ---
+
+    //! Compute the Fourier transform of the real samples stored in the
+    //! transform input buffer. The first size()/2 + 1 complex transform 
+    //! samples are accessed by subscript. The contents of the input buffer
+    //! are unspecified after computing the transform.
+    void transform( void );
+
+//	--- inquiry ---
+
+    //! Return the length of the transform (in samples).
+    //!
+    //! \return the length of the transform in samples.
+    size_type size( void ) const ;
+
+//	-- instance variables --
+private:
+
+    // insulating implementation instance (defined in
+    // FourierTransform.C), conceals interface to FFTW
+    RFTimpl * _impl;
+
+    //! buffer (owned by _impl) containing the real transform input
+    double * _input;
+
+    //! buffer (owned by _impl) containing the first half of the 
+    //! complex transform output, size()/2 + 1 samples
+    const std::complex< double > * _output;
+
+    //! the length of the transform
+    size_type _size;
+
+};	//	end of class RealFourierTransform
 
 }	//	end of namespace Loris
 
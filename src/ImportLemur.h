@@ -77,6 +77,8 @@ class ImportException : public Exception
 public: 
 	ImportException( const std::string & str, const std::string & where = "" ) : 
 		Exception( std::string("Import Error -- ").append( str ), where ) {}		
+	ImportException * clone( void ) const { return new ImportException( *this ); }
+	void raise( void ) const { throw *this; }
 };
 
 }	//	end of namespace Loris
@@ -34,11 +34,168 @@
  */
 
 #include "Envelope.h"
-#include <map>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 //  begin namespace
 namespace Loris {
 
+// ---------------------------------------------------------------------------
+//  class LinearEnvelope_Iterator
+//
+//! Non-const iterator over the (time, value) breakpoints in a 
+//! LinearEnvelope. Wraps the iterator for the underlying vector of
+//! (time, value) pairs, but dereferences to a Point, through which
+//! the value of a breakpoint can be changed, but not its time, since
+//! the breakpoints must remain sorted by time. LinearEnvelope_Iterator 
+//! implements a bidirectional iterator interface.
+//
+class LinearEnvelope_Iterator
+{
+//  -- instance variables --
+
+    typedef std::vector< std::pair< double, double > > BaseContainer;
+    typedef BaseContainer::iterator BaseIterator;
+    typedef BaseContainer::const_iterator BaseConstIterator;
+    BaseIterator _iter;
+    
+//  -- public interface --
+public:
+
+    //! A breakpoint in a LinearEnvelope, having a read-only time
+    //! (first) and a writable value (second), like the elements
+    //! of a std::map.
+    struct Point
+    {
+        const double & first;   //!< the time of the breakpoint
+        double & second;        //!< the value of the breakpoint
+        
+        Point( std::pair< double, double > & p ) : 
+            first( p.first ), second( p.second ) {}
+
+        //! Return a copy of the (time, value) pair.
+        operator std::pair< double, double > ( void ) const 
+            { return std::pair< double, double >( first, second ); }
+    };
+    
+    //! Pointer-like wrapper for a Point, returned by operator->.
+    class Arrow
+    {
+        Point _pt;
+    public:
+        Arrow( std::pair< double, double > & p ) : _pt( p ) {}
+        Point * operator -> ( void ) { return & _pt; }
+    };
+    
+//  -- bidirectional iterator interface --
+
+    //! The iterator category, for compatibility with 
+    //! C++ standard library algorithms 
+    typedef std::bidirectional_iterator_tag iterator_category;
+    
+    //! The type of element that can be accessed through this 
+    //! iterator, a (time, value) pair.
+    typedef std::pair< double, double >     value_type;
+    
+    //! The type representing the distance between two of these
+    //! iterators.
+    typedef BaseIterator::difference_type   difference_type;
+    
+    //! The type returned by operator->.
+    typedef Arrow                           pointer;
+
+    //! The type returned by dereferencing this iterator.
+    typedef Point                           reference;
+
+//  construction:
+    
+    //! Construct a new iterator referring to no position in 
+    //! any LinearEnvelope.
+    LinearEnvelope_Iterator( void ) {}
+    
+    //  (allow compiler to generate copy, assignment, and destruction)
+
+    //! Convert to a const iterator referring to the same position.
+    operator BaseConstIterator ( void ) const { return _iter; }
+    
+//  increment/decrement:
+
+    //! Pre-increment operator - advance the position of the iterator
+    //! and return the iterator itself.
+    LinearEnvelope_Iterator & operator ++ () { ++_iter; return *this; }
+
+    //! Pre-decrement operator - move the position of the iterator
+    //! back by one and return the iterator itself.
+    LinearEnvelope_Iterator & operator -- () { --_iter; return *this; }
+
+    //! Post-increment operator - advance the position of the iterator
+    //! and return a copy of the iterator before it was advanced.
+    LinearEnvelope_Iterator operator ++ ( int ) 
+        { return LinearEnvelope_Iterator( _iter++ ); } 
+
+    //! Post-decrement operator - move the position of the iterator
+    //! back by one and return a copy of the iterator before it was 
+    //! decremented.
+    LinearEnvelope_Iterator operator -- ( int ) 
+        { return LinearEnvelope_Iterator( _iter-- ); } 
+    
+//  dereference:
+
+    //! Dereference operator.
+    //!
+    //! \return A Point referring to the time and value of the 
+    //!         breakpoint at the position of this iterator.
+    Point operator * ( void ) const { return Point( *_iter ); }
+
+    //! Pointer operator.
+    //!
+    //! \return An object through which the time (first) and value
+    //!         (second) of the breakpoint at the position of this 
+    //!         iterator can be accessed.
+    Arrow operator -> ( void ) const { return Arrow( *_iter ); }
+        
+//  comparison (with non-const and const iterators):
+
+    //! Equality comparison operator.
+    friend bool operator == ( const LinearEnvelope_Iterator & lhs, 
+                              const LinearEnvelope_Iterator & rhs )
+        { return lhs._iter == rhs._iter; }
+
+    //! Equality comparison operator.
+    friend bool operator == ( const LinearEnvelope_Iterator & lhs, 
+                              const BaseConstIterator & rhs )
+        { return BaseConstIterator( lhs._iter ) == rhs; }
+
+    //! Equality comparison operator.
+    friend bool operator == ( const BaseConstIterator & lhs, 
+                              const LinearEnvelope_Iterator & rhs )
+        { return lhs == BaseConstIterator( rhs._iter ); }
+
+    //! Inequality comparison operator.
+    friend bool operator != ( const LinearEnvelope_Iterator & lhs, 
+                              const LinearEnvelope_Iterator & rhs )
+        { return lhs._iter != rhs._iter; }
+
+    //! Inequality comparison operator.
+    friend bool operator != ( const LinearEnvelope_Iterator & lhs, 
+                              const BaseConstIterator & rhs )
+        { return BaseConstIterator( lhs._iter ) != rhs; }
+
+    //! Inequality comparison operator.
+    friend bool operator != ( const BaseConstIterator & lhs, 
+                              const LinearEnvelope_Iterator & rhs )
+        { return lhs != BaseConstIterator( rhs._iter ); }
+    
+//  -- BaseIterator conversions --
+private:
+    //  construction by LinearEnvelope from a BaseIterator:
+    explicit LinearEnvelope_Iterator( const BaseIterator & it ) : _iter( it ) {}
+    
+    friend class LinearEnvelope;
+    
+};  //  end of class LinearEnvelope_Iterator
+
 // ---------------------------------------------------------------------------
 //  class LinearEnvelope
 //
@@ -53,21 +210,29 @@ namespace Loris {
 //! LinearEnvelope inherits the types
 //!     \li \c size_type
 //!     \li \c value_type
-//!     \li \c iterator
 //!     \li \c const_iterator
 //!
 //! and the member functions
 //!     \li size_type size( void ) const
 //!     \li bool empty( void ) const
-//!     \li iterator begin( void )
 //!     \li const_iterator begin( void ) const
-//!     \li iterator end( void )
 //!     \li const_iterator end( void ) const
 //!
-//! from std::map< double, double >.
+//! from std::vector< std::pair< double, double > >. The (time, value)
+//! pairs are stored in a flat array, sorted by time, so iterators 
+//! are invalidated by insertion of a new breakpoint. The non-const
+//! iterator is a LinearEnvelope_Iterator, through which the values
+//! of the breakpoints can be changed, but not their times.
 //
-class LinearEnvelope : public Envelope, private std::map< double, double >
+class LinearEnvelope : public Envelope, 
+                       private std::vector< std::pair< double, double > >
 {
+//  -- types --
+
+    //! underlying container type: a vector of (time, value) 
+    //! pairs sorted by time
+    typedef std::vector< std::pair< double, double > > container_type;
+
 //  -- public interface --
 public:
 //  -- construction --
@@ -99,6 +264,20 @@ public:
     //!         LinearEnvelope.
     virtual double valueAt( double t ) const;   
         
+    //! Store in values the linearly-interpolated values of this 
+    //! LinearEnvelope at the n specified times. Non-decreasing
+    //! sequences of times are evaluated by walking the breakpoints
+    //! instead of searching for each time, and an envelope having
+    //! fewer than two breakpoints (a constant) is not searched 
+    //! at all.
+    //! 
+    //! \param  times is the array of n times at which to evaluate
+    //!         this LinearEnvelope.
+    //! \param  values is the array of (at least) n values in which
+    //!         to store the results.
+    //! \param  n is the number of times to evaluate.
+    virtual void valuesAt( const double * times, double * values, long n ) const;
+        
     
 //  -- envelope composition --
 
@@ -153,17 +332,30 @@ public:
         return operator*=( 1.0 / div );
     }
 
-//  -- interface inherited from std::map --
-
-    using std::map< double, double >::size;
-    using std::map< double, double >::empty;
-    using std::map< double, double >::clear;
-    using std::map< double, double >::begin;
-    using std::map< double, double >::end;
-    using std::map< double, double >::size_type;
-    using std::map< double, double >::value_type;
-    using std::map< double, double >::iterator;
-    using std::map< double, double >::const_iterator;
+//  -- interface inherited from std::vector --
+
+    using container_type::size;
+    using container_type::empty;
+    using container_type::clear;
+    using container_type::begin;
+    using container_type::end;
+    using container_type::size_type;
+    using container_type::value_type;
+    using container_type::const_iterator;
+
+//  -- iteration --
+
+    //! non-const iterator over the (time, value) breakpoints, 
+    //! through which only values can be changed
+    typedef LinearEnvelope_Iterator iterator;
+
+    //! Return an iterator refering to the first breakpoint in
+    //! this LinearEnvelope.
+    iterator begin( void ) { return iterator( container_type::begin() ); }
+
+    //! Return an iterator refering to the position past the last
+    //! breakpoint in this LinearEnvelope.
+    iterator end( void ) { return iterator( container_type::end() ); }
 
 };  //  end of class LinearEnvelope
 
@@ -98,6 +98,21 @@ public:
 	   return _sbuf; 
 	}
 
+//	--- copying ---
+
+	//! Return a new copy of this Exception, allocated on the heap,
+	//! having the same type as this Exception. Every derived class 
+	//! overrides clone and raise, so that an Exception can be 
+	//! stored and re-thrown, without losing its type (for example, 
+	//! in another thread, see Parallel::run). 
+	//!
+	//! \return a new copy of this Exception, owned by the caller
+	virtual Exception * clone( void ) const { return new Exception( *this ); }
+	
+	//! Throw a copy of this Exception, having the same type
+	//! as this Exception.
+	virtual void raise( void ) const { throw *this; }
+
 //	-- instance variables --
 protected:
 
@@ -130,7 +145,13 @@ public:
 		Exception( std::string("Assertion failed -- ").append( str ), where ) 
 	{
 	}
-	
+
+	//! Return a new copy of this AssertionFailure, allocated on the heap.
+	AssertionFailure * clone( void ) const { return new AssertionFailure( *this ); }
+
+	//! Throw a copy of this AssertionFailure.
+	void raise( void ) const { throw *this; }
+
 };	//	end of class AssertionFailure
 
 // ---------------------------------------------------------------------------
@@ -154,7 +175,13 @@ public:
    //!         (generated automatically by the Throw macro).
 	IndexOutOfBounds( const std::string & str, const std::string & where = "" ) : 
 		Exception( std::string("Index out of bounds -- ").append( str ), where ) {}
-		
+
+	//! Return a new copy of this IndexOutOfBounds, allocated on the heap.
+	IndexOutOfBounds * clone( void ) const { return new IndexOutOfBounds( *this ); }
+
+	//! Throw a copy of this IndexOutOfBounds.
+	void raise( void ) const { throw *this; }
+
 };	//	end of class IndexOutOfBounds
 
 
@@ -181,7 +208,13 @@ public:
 		Exception( std::string("Invalid configuration or object -- ").append( str ), where ) 
 	{
 	}
-	
+
+	//! Return a new copy of this InvalidObject, allocated on the heap.
+	InvalidObject * clone( void ) const { return new InvalidObject( *this ); }
+
+	//! Throw a copy of this InvalidObject.
+	void raise( void ) const { throw *this; }
+
 };	//	end of class InvalidObject
 
 // ---------------------------------------------------------------------------
@@ -207,7 +240,13 @@ public:
 		InvalidObject( std::string("Invalid Iterator -- ").append( str ), where ) 
 	{
 	}
-	
+
+	//! Return a new copy of this InvalidIterator, allocated on the heap.
+	InvalidIterator * clone( void ) const { return new InvalidIterator( *this ); }
+
+	//! Throw a copy of this InvalidIterator.
+	void raise( void ) const { throw *this; }
+
 };	//	end of class InvalidIterator
 
 // ---------------------------------------------------------------------------
@@ -232,7 +271,13 @@ public:
 		Exception( std::string("Invalid Argument -- ").append( str ), where ) 
 	{
 	}
-	
+
+	//! Return a new copy of this InvalidArgument, allocated on the heap.
+	InvalidArgument * clone( void ) const { return new InvalidArgument( *this ); }
+
+	//! Throw a copy of this InvalidArgument.
+	void raise( void ) const { throw *this; }
+
 };	//	end of class InvalidArgument
 
 // ---------------------------------------------------------------------------
@@ -258,7 +303,13 @@ public:
 		Exception( std::string("Runtime Error -- ").append( str ), where ) 
 	{
 	}
-	
+
+	//! Return a new copy of this RuntimeError, allocated on the heap.
+	RuntimeError * clone( void ) const { return new RuntimeError( *this ); }
+
+	//! Throw a copy of this RuntimeError.
+	void raise( void ) const { throw *this; }
+
 };	//	end of class RuntimeError
 
 // ---------------------------------------------------------------------------
@@ -283,7 +334,13 @@ public:
 		RuntimeError( std::string("File i/o error -- ").append( str ), where ) 
    {
    }
-   
+
+	//! Return a new copy of this FileIOException, allocated on the heap.
+	FileIOException * clone( void ) const { return new FileIOException( *this ); }
+
+	//! Throw a copy of this FileIOException.
+	void raise( void ) const { throw *this; }
+
 };	//	end of class FileIOException
 
 // ---------------------------------------------------------------------------
@@ -36,6 +36,7 @@
 #include "Partial.h"
 
 #include <memory>   // for auto_ptr
+#include <vector>
 
 //  begin namespace
 namespace Loris {
@@ -110,6 +111,10 @@ class Morpher
     bool _doLogFreqMorphing;        //! if true, frequencies are morphed in the log 
                                     //! domain, if false (default) they  are morphed  
                                     //! in the linear domain.
+
+    unsigned int _numThreads;       //! number of threads used to morph corresponding
+                                    //! pairs of Partials, or 0 for one thread per
+                                    //! available processor. Default is 1.
     
     
 //  -- public interface --
@@ -164,11 +169,11 @@ public:
     //!         value of 1, evaluated at the specified time.
     //! \param  assignLabel is the label assigned to the morphed Partial
     //! \return the morphed Partial
-    Partial morphPartials( Partial src, Partial tgt, int assignLabel );
+    Partial morphPartials( const Partial & src, const Partial & tgt, int assignLabel ) const;
     
     //! Bad legacy name for morphPartials.
     //! \deprecated Use morphPartials instead.
-    Partial morphPartial( Partial src, Partial tgt, int assignLabel )
+    Partial morphPartial( const Partial & src, const Partial & tgt, int assignLabel ) const
         { return morphPartials( src, tgt, assignLabel ); }
 
     //! Morph two sounds (collections of Partials labeled to indicate
@@ -374,6 +379,24 @@ public:
     //! \throw  InvalidArgument if the specified gap is not positive
     void setMinBreakpointGap( double x );
 
+    //! Return the number of threads used to morph the pairs of 
+    //! corresponding Partials in a morph of two sequences of Partials,
+    //! or 0 if one thread per available processor is used. (Default 
+    //! is 1, serial morphing.)
+    unsigned int numThreads( void ) const;
+    
+    //! Set the number of threads used to morph the pairs of 
+    //! corresponding Partials in a morph of two sequences of Partials.
+    //! Each pair is morphed independently, and the morphed Partials 
+    //! are stored in the Morpher's PartialList in order of increasing
+    //! label, so the morphed Partials do not depend on the number of
+    //! threads. Unlabeled Partials are still crossfaded by the calling
+    //! thread. (Default is 1, serial morphing.)
+    //!
+    //! \param  n is the number of threads to use, or 0 to use
+    //!         one thread per available processor.
+    void setNumThreads( unsigned int n );
+
 
 //  -- reference Partial label access/mutation --
     
@@ -532,6 +555,18 @@ private:
     //! morph() implementation accepting two sequences of Partials.
     void morph_aux( PartialCorrespondence & correspondence );
     
+    //! Helper function that morphs a single pair of corresponding 
+    //! Partials, having the specified label, and returns the morphed
+    //! Partial. Called by morph_aux, possibly from several threads 
+    //! at once, so it must not modify the Morpher.
+    Partial morphCorrespondingPartials( Partial::label_type label, 
+                                        MorphingPair & match ) const;
+    
+    //! ParallelTask used by morph_aux to morph pairs of corresponding
+    //! Partials using several threads.
+    class MorphTask;
+    friend class MorphTask;
+    
     //! Compute morphed parameter values at the specified time, using
     //! the source Breakpoint (assumed to correspond exactly to the
     //! specified time) and the target Partial (whose parameters are
@@ -543,15 +578,28 @@ private:
     //!
     //! \param  srcBkpt is the Breakpoint corresponding to a morph function
     //!         value of 0.
-    //! \param  tgtPartial is the Partial corresponding to a morph function
-    //!         value of 1, evaluated at the specified time.
+    //! \param  tgtCursor is a cursor on the Partial corresponding to a 
+    //!         morph function value of 1, evaluated at the specified time
+    //!         (usually later than the time of the previous evaluation).
+    //! \param  srcRefCursor is a cursor on the source reference Partial, 
+    //!         which may be a dummy Partial (no Breakpoints).
+    //! \param  tgtRefCursor is a cursor on the target reference Partial, 
+    //!         which may be a dummy Partial (no Breakpoints).
     //! \param  time is the time corresponding to srcBkpt (used
-    //!         to evaluate the morphing functions and tgtPartial).
+    //!         to evaluate that Partial).
+    //! \param  fweight is the value of the frequency morphing function
+    //!         at the specified time.
+    //! \param  aweight is the value of the amplitude morphing function
+    //!         at the specified time.
+    //! \param  bweight is the value of the bandwidth morphing function
+    //!         at the specified time.
     //! \param  newp is the morphed Partial under construction, the morphed
     //!         Breakpoint is added to this Partial.
     //
-    void appendMorphedSrc( Breakpoint srcBkpt, const Partial & tgtPartial, 
-                           double time, Partial & newp  );
+    void appendMorphedSrc( Breakpoint srcBkpt, PartialCursor & tgtCursor, 
+                           PartialCursor & srcRefCursor, PartialCursor & tgtRefCursor,
+                           double time, double fweight, double aweight, 
+                           double bweight, Partial & newp  ) const;
                            
     //! Compute morphed parameter values at the specified time, using
     //! the target Breakpoint (assumed to correspond exactly to the
@@ -564,15 +612,28 @@ private:
     //!
     //! \param  tgtBkpt is the Breakpoint corresponding to a morph function
     //!         value of 1.
-    //! \param  srcPartial is the Partial corresponding to a morph function
-    //!         value of 0, evaluated at the specified time.
+    //! \param  srcCursor is a cursor on the Partial corresponding to a 
+    //!         morph function value of 0, evaluated at the specified time
+    //!         (usually later than the time of the previous evaluation).
+    //! \param  srcRefCursor is a cursor on the source reference Partial, 
+    //!         which may be a dummy Partial (no Breakpoints).
+    //! \param  tgtRefCursor is a cursor on the target reference Partial, 
+    //!         which may be a dummy Partial (no Breakpoints).
     //! \param  time is the time corresponding to srcBkpt (used
-    //!         to evaluate the morphing functions and srcPartial).
+    //!         to evaluate that Partial).
+    //! \param  fweight is the value of the frequency morphing function
+    //!         at the specified time.
+    //! \param  aweight is the value of the amplitude morphing function
+    //!         at the specified time.
+    //! \param  bweight is the value of the bandwidth morphing function
+    //!         at the specified time.
     //! \param  newp is the morphed Partial under construction, the morphed
     //!         Breakpoint is added to this Partial.
     //
-    void appendMorphedTgt( Breakpoint tgtBkpt, const Partial & srcPartial, 
-                           double time, Partial & newp  );
+    void appendMorphedTgt( Breakpoint tgtBkpt, PartialCursor & srcCursor, 
+                           PartialCursor & srcRefCursor, PartialCursor & tgtRefCursor,
+                           double time, double fweight, double aweight, 
+                           double bweight, Partial & newp  ) const;
                            
                            
 	//!	Parameterinterpolation helpers.
@@ -586,6 +647,10 @@ private:
 	double interpolatePhase( double srcphase, double tgtphase, double alpha ) const;
 	
 
+	//	Evaluate the three morphing functions at the times of all 
+	//	the Breakpoints in a Partial (see Morpher.C).
+	void evaluateMorphFunctions( const Partial & p, std::vector< double > & weights ) const;
+
 	//	Recompute phases for a morphed Partial, so that the synthesized phases 
 	//	match the source phases as closesly as possible at times when the 
 	//	frequency morphing function is equal to 0 or 1. 
@@ -47,11 +47,35 @@ class NoiseGenerator
 
 public:
 
+	//!	Algorithms for generating noise. 
+	//!
+	//!	ParkMiller (the default) is the generator Loris has always
+	//!	used, a Park-Miller uniform generator implemented in doubles,
+	//!	transformed using the polar form of the Box-Muller 
+	//!	transformation. It should be used to reproduce exactly the
+	//!	samples rendered by earlier versions of Loris.
+	//!
+	//!	Counter computes the random bits for each sample by hashing 
+	//!	its position in the sequence with the seed, so blocks of noise
+	//!	can be generated without a dependency from each sample to the 
+	//!	next, and transforms them using the ziggurat method, which needs
+	//!	no transcendental functions for about 99 samples in 100. It is 
+	//!	about three times faster, and produces different samples, 
+	//!	having a true unit variance (the rejection step of the legacy
+	//!	generator reduces its variance to about 0.89).
+	enum Algorithm 
+	{
+		ParkMiller = 0,
+		Counter = 1
+	};
+
 	//!	Create a new noise generator with the (optionally) specified
-	//! seed (default is 1.0).
+	//! seed (default is 1.0), using the (optionally) specified 
+	//!	algorithm (default is ParkMiller).
 	//!
 	//!	\param initSeed is the initial seed for the random number generator
-	explicit NoiseGenerator( double initSeed = 1.0 );
+	//!	\param alg is the algorithm used to generate noise
+	explicit NoiseGenerator( double initSeed = 1.0, Algorithm alg = ParkMiller );
 
 
 	//	copy and assign are free
@@ -62,6 +86,9 @@ public:
 	//!	\param newSeed is the new seed for the random number generator
 	void seed( double newSeed );
 	
+	//!	Return the algorithm used by this generator.
+	Algorithm algorithm( void ) const { return m_algorithm; }
+	
 	//	sample
 	//
 	//!	Generate and return a new sample of Gaussian noise having zero
@@ -77,6 +104,29 @@ public:
 	//!	\sa sample
 	double operator() ( void ) 	{ return sample(); }
 	
+	//	fill
+	//
+	//!	Generate samples of Gaussian noise having zero mean and unity 
+	//!	standard deviation, and store them in the half-open range
+	//!	[begin, end). The samples are the same as would be returned by
+	//!	calling sample() end - begin times, but using the Counter 
+	//!	algorithm, no sample depends on the one before it, so they are 
+	//!	generated without the overhead of a call for each sample.
+	//!
+	//!	\param begin is the beginning of the range of samples to fill
+	//!	\param end is the end of the range of samples to fill
+	void fill( double * begin, double * end );
+	
+	//!	Return a seed for a noise generator that produces the 
+	//!	specified stream of noise. Generators seeded using different
+	//!	stream indices produce uncorrelated sequences, so a stream 
+	//!	index can be assigned to each of several concurrent users
+	//!	of noise (like the oscillators rendering several Partials)
+	//!	to make the noise each one uses reproducible.
+	//!
+	//!	\param stream is the index of the noise stream
+	static double streamSeed( unsigned long stream );
+	
 
 //	--- implementation ---
 private:
@@ -84,6 +134,7 @@ private:
 	//	random number generation helpers
 	inline double uniform( void );
 	inline double gaussian_normal( void );
+	void fill_counter( double * begin, double * end );
 
 
 	// random number generator state variables
@@ -91,6 +142,12 @@ private:
 	double m_gset;
 	bool m_iset;
 	
+	//	Counter algorithm state, the hashed seed and the
+	//	position of the next sample in the sequence:
+	Algorithm m_algorithm;
+	unsigned long m_key;
+	unsigned long m_counter;
+	
 };
 
 
@@ -96,6 +96,18 @@ public:
     //! and collated Partials.
     void setPhase( double ph );
 
+    //! Reset the noise generator used for bandwidth enhancement
+    //! to produce the specified stream of noise (see 
+    //! NoiseGenerator::streamSeed), so that the noise used to render
+    //! a Partial does not depend on the Partials rendered before it.
+    void resetNoise( unsigned long stream );
+
+    //! Select the algorithm used to generate the noise for bandwidth
+    //! enhancement (see NoiseGenerator::Algorithm), replacing the noise
+    //! generator with a new one, seeded as at construction. Noise 
+    //! generators used after resetNoise use the same algorithm.
+    void setNoiseAlgorithm( NoiseGenerator::Algorithm alg );
+
     //! Accumulate bandwidth-enhanced sinusoidal samples modulating the
     //! oscillator state from its current values of radian frequency, amplitude,
     //! and bandwidth to the specified target values. Accumulate samples into
@@ -124,6 +136,11 @@ public:
     //! implement bandwidth-enhanced sinusoidal synthesis.
     Filter & filter( void ) { return m_filter; }
     
+    //! Return the algorithm used to generate the noise for 
+    //! bandwidth enhancement.
+    NoiseGenerator::Algorithm noiseAlgorithm( void ) const 
+        { return m_modulator.algorithm(); }
+    
 // --- static members ---
 
     //! Static local function for obtaining a prototype Filter
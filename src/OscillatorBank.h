@@ -0,0 +1,311 @@
+#ifndef INCLUDE_OSCILLATORBANK_H
+#define INCLUDE_OSCILLATORBANK_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * OscillatorBank.h
+ *
+ * Definition of class Loris::OscillatorBank, a bank of Bandwidth-Enhanced
+ * Oscillators that render many Partials concurrently, in blocks of samples.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "Filter.h"
+#include "NoiseGenerator.h"
+#include "Partial.h"
+
+#include <cmath>
+#include <deque>
+#include <vector>
+
+//  begin namespace
+namespace Loris {
+
+class Resampler;
+
+// ---------------------------------------------------------------------------
+//  class OscillatorBank
+//
+//! Class OscillatorBank renders many bandwidth-enhanced Partials
+//! concurrently, in blocks of BlockSize samples. Each Partial sounding
+//! in a block is assigned a lane, and for each lane, the instantaneous
+//! phase and (noise-modulated) amplitude of each sample in the block are
+//! stored in arrays. Then the samples of all the lanes are computed and 
+//! summed in a single loop having no branches, that can be vectorized 
+//! by the compiler. Cosines are computed using fastCos, a polynomial 
+//! approximation, instead of std::cos.
+//!
+//! Each lane follows exactly the same Breakpoint semantics as
+//! Synthesizer and Oscillator: fade in from a null Breakpoint, phase
+//! reset at the onset of each non-zero-amplitude segment, linear
+//! parameter trajectories between Breakpoints, no rendering above the
+//! half-sample rate, and a fade out after the last Breakpoint. The
+//! rendered samples differ from those computed by Oscillator only by
+//! the (bounded) error in fastCos, and in the realization of the
+//! bandwidth-enhancement noise: each lane has its own noise generator,
+//! seeded by the stream index of the Partial it is rendering, so that
+//! the noise does not depend on the order in which Partials are
+//! rendered or on how they are grouped.
+//!
+//! Optionally, the per-sample phases and amplitudes can be stored, and
+//! the cosines computed and summed, in single precision (float), using
+//! fastCosf, halving the memory traffic and doubling the number of 
+//! samples per vector operation. The oscillator state, in particular
+//! the phase accumulator, is always double precision, and each phase
+//! is reduced to [-pi, pi] before it is rounded to single precision, 
+//! so the error in the rendered samples does not grow with the length
+//! of a Partial. (Blocks are summed into the sample buffer in double
+//! precision.) This is the only single-precision computation in Loris:
+//! Partials are always analyzed, stored, and rendered into sample 
+//! buffers in double precision.
+//!
+//! Class Synthesizer uses an OscillatorBank when configured to do so.
+//
+class OscillatorBank
+{
+//  --- interface ---
+public:
+
+    //! The number of samples rendered at a time.
+    enum { BlockSize = 64 };
+
+//  --- construction ---
+
+    //! Construct a new OscillatorBank using the specified Filter
+    //! (coefficients) for bandwidth enhancement in every lane, and
+    //! the specified noise generation algorithm (default is 
+    //! NoiseGenerator::ParkMiller).
+    //!
+    //! \param  filter is the prototype for the filter applied
+    //!         to the noise generator in each lane.
+    //! \param  noise is the algorithm used by the noise generator
+    //!         in each lane.
+    explicit OscillatorBank( const Filter & filter, 
+                             NoiseGenerator::Algorithm noise = NoiseGenerator::ParkMiller );
+
+    //  Copy, assignment, and destruction are free.
+
+// --- access/mutation ---
+
+    //! Return true if this OscillatorBank stores the per-sample phases
+    //! and amplitudes, and computes and sums the samples in each block,
+    //! in single precision, and false (the default) if it uses double
+    //! precision.
+    bool usesSinglePrecision( void ) const { return m_singlePrecision; }
+
+    //! Specify whether this OscillatorBank should store the per-sample 
+    //! phases and amplitudes, and compute and sum the samples in each
+    //! block, in single precision. The rendered samples differ from
+    //! those rendered in double precision by at most about 
+    //! FastCosfMaxError times the sum of the Partial amplitudes.
+    //!
+    //! \param  single is true to render in single precision, and 
+    //!         false to render in double precision.
+    void setUseSinglePrecision( bool single ) { m_singlePrecision = single; }
+
+// --- rendering ---
+
+    //! Render the specified Partials, accumulating samples into the 
+    //! buffer. The Breakpoint times are quantized to the sample grid
+    //! (see Resampler::quantize) as each Partial is started, the Partials
+    //! are not modified. The Partials must be non-empty and have 
+    //! non-negative start times. The buffer must be large enough to hold
+    //! the fade out after the (quantized) end of each Partial, that is, 
+    //! at least ( endTime + fadeTime ) * srate + 1 samples, less the offset.
+    //!
+    //! \param  partials points to an array of pointers to the Partials
+    //!         to render.
+    //! \param  streams points to an array of noise stream indices, one
+    //!         for each Partial, used to seed the noise generators.
+    //! \param  npartials is the number of Partials to render.
+    //! \param  srate is the sample rate in Hz.
+    //! \param  fadeTime is the Partial fade in and fade out time in seconds.
+    //! \param  buffer is the sample buffer.
+    //! \param  offset is the index of the sample stored at the start of
+    //!         the buffer, no Partial may fade in before that sample.
+    void render( const Partial * const * partials,
+                 const unsigned long * streams,
+                 long npartials, double srate, double fadeTime,
+                 double * buffer, unsigned long offset = 0 );
+
+// --- static members ---
+
+    //! Return an approximation of cos( x ) computed using a polynomial,
+    //! having absolute error less than FastCosMaxError for |x| less than
+    //! 1000 (radians). For larger |x|, the error grows in proportion to
+    //! |x|, because of the limited precision of the phase reduction, and
+    //! |x| must be less than 2^31 * pi.
+    static inline double fastCos( double x );
+
+    //! Bound on the absolute error in fastCos for |x| less than 1000.
+    static const double FastCosMaxError;
+
+    //! Return a single-precision approximation of cos( x ) computed 
+    //! using a polynomial, having absolute error less than 
+    //! FastCosfMaxError for |x| not greater than pi. For larger |x|, 
+    //! the error grows in proportion to |x| (reduce the phase in
+    //! double precision first).
+    static inline float fastCosf( float x );
+
+    //! Bound on the absolute error in fastCosf for |x| not greater than pi.
+    static const double FastCosfMaxError;
+
+//  --- implementation ---
+private:
+
+    //  The state of the oscillator in one lane, and the bookkeeping 
+    //  for the Breakpoints of the Partial it is rendering.
+    struct Lane
+    {
+        //  oscillator state:
+        double phase;               //  radians
+        double frequency;           //  radians per sample
+        double amplitude;
+        double bandwidth;
+        double dFreqOver2;          //  half the per-sample frequency increment
+        double dAmp;
+        double dBw;
+        double tgtFrequency;        //  segment target values
+        double tgtAmplitude;
+        double tgtBandwidth;
+        unsigned long remaining;    //  samples left in current segment
+        bool noisy;                 //  bandwidth-enhanced segment
+
+        NoiseGenerator modulator;
+        Filter filter;
+
+        //  Breakpoint bookkeeping:
+        std::vector< double > times;    //  quantized Breakpoint times and
+        std::vector< Breakpoint > breakpoints;  //  Breakpoints of the Partial
+        std::vector< double >::size_type next;  //  index of the next Breakpoint
+                                                //  (segment target)
+        unsigned long position;         //  index of the next sample to render
+        unsigned long currentSamp;      //  sample index at which the current
+                                        //  segment ends
+        unsigned long endSamp;          //  last sample of the fade out
+        double prevFrequency;           //  frequency (Hz) of the last target
+        bool fadingOut;                 //  rendering the fade out segment
+        bool done;                      //  no more segments
+
+        explicit Lane( const Filter & f ) : filter( f ) {}
+    };
+
+    void startPartial( Lane & lane, const Partial & p, unsigned long stream,
+                       const Resampler & quantizer, double srate, double fadeTime );
+    void startSegment( Lane & lane, double srate, double fadeTime );
+    template< typename T >
+    void renderBlock( unsigned long blockBegin, unsigned long count,
+                      double srate, double fadeTime,
+                      std::vector< T > & phases, std::vector< T > & amplitudes,
+                      double * out );
+    template< typename T >
+    void fillLane( Lane & lane, unsigned long blockBegin, unsigned long count,
+                   double srate, double fadeTime,
+                   double * phases, T * amplitudes );
+
+    Filter m_filter;                    //  prototype for the lane filters
+    NoiseGenerator::Algorithm m_noiseAlgorithm;
+                                        //  algorithm for the lane noise generators
+    std::deque< Lane > m_lanes;         //  all lanes, active and free (not
+                                        //  a vector, because copying a Filter
+                                        //  does not copy its state)
+    std::vector< long > m_active;       //  indices of lanes in use
+    std::vector< long > m_free;         //  indices of lanes not in use
+    
+    std::vector< double > m_phases;     //  per-sample phase and amplitude
+    std::vector< double > m_amplitudes; //  in each active lane, BlockSize
+                                        //  samples per lane
+    std::vector< float > m_phasesf;     //  same, rendering in single 
+    std::vector< float > m_amplitudesf; //  precision (phases reduced)
+    double m_noise[ BlockSize ];        //  filtered noise, and phases in
+    double m_phaseBlock[ BlockSize ];   //  double precision, for one lane
+    bool m_singlePrecision;             //  render in single precision
+
+};  //  end of class OscillatorBank
+
+// ---------------------------------------------------------------------------
+//  fastCos
+// ---------------------------------------------------------------------------
+//  Reduce the phase to [-pi/2, pi/2] by subtracting the nearest multiple
+//  k of pi (cosine is even, so the phase can be made non-negative, and 
+//  the conversion to int rounds it), and evaluate the Taylor series 
+//  through the x^14 term, whose truncation error is less than 7E-11 at 
+//  pi/2, negated if k is odd. Branch-free, so that loops calling it can
+//  be vectorized.
+//
+inline double OscillatorBank::fastCos( double x )
+{
+    static const double Pi = 3.14159265358979324;
+    static const double OneOverPi = 1 / Pi;
+
+    x = std::fabs( x );
+    const int k = int( x * OneOverPi + 0.5 );
+    x -= Pi * k;
+    const double sign = 1 - 2 * ( k & 1 );
+
+    const double x2 = x * x;
+    double c = -1. / 87178291200.;
+    c = c * x2 + 1. / 479001600.;
+    c = c * x2 - 1. / 3628800.;
+    c = c * x2 + 1. / 40320.;
+    c = c * x2 - 1. / 720.;
+    c = c * x2 + 1. / 24.;
+    c = c * x2 - 1. / 2.;
+    c = c * x2 + 1.;
+    return sign * c;
+}
+
+// ---------------------------------------------------------------------------
+//  fastCosf
+// ---------------------------------------------------------------------------
+//  Reduce the phase to [-pi/2, pi/2] as in fastCos, and evaluate the 
+//  Taylor series through the x^12 term, whose truncation error is less
+//  than 5E-7 at pi/2, in single precision. 
+//
+inline float OscillatorBank::fastCosf( float x )
+{
+    static const float Pi = 3.14159265358979324f;
+    static const float OneOverPi = 1 / Pi;
+
+    x = std::fabs( x );
+    const int k = int( x * OneOverPi + 0.5f );
+    x -= Pi * k;
+    const float sign = float( 1 - 2 * ( k & 1 ) );
+
+    const float x2 = x * x;
+    float c = 1.f / 479001600.f;
+    c = c * x2 - 1.f / 3628800.f;
+    c = c * x2 + 1.f / 40320.f;
+    c = c * x2 - 1.f / 720.f;
+    c = c * x2 + 1.f / 24.f;
+    c = c * x2 - 1.f / 2.f;
+    c = c * x2 + 1.f;
+    return sign * c;
+}
+
+}   //  end of namespace Loris
+
+#endif /* ndef INCLUDE_OSCILLATORBANK_H */
@@ -0,0 +1,126 @@
+#ifndef INCLUDE_PARALLEL_H
+#define INCLUDE_PARALLEL_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * Parallel.h
+ *
+ * Definition of class Loris::ParallelTask and the Loris::Parallel
+ * helpers used to farm independent jobs out to worker threads.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+//	begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//	class ParallelTask
+//
+//!	ParallelTask is an abstract base class for a collection of independent
+//!	jobs, identified by index, that can be executed concurrently by a
+//!	number of workers. Each job is executed exactly once, by exactly one
+//!	worker, but jobs may be executed in any order, so derived classes
+//!	should store the result of each job in a slot reserved for it, and
+//!	assemble the results (in job order) after Parallel::run returns.
+//!	This is what makes the parallel algorithms in Loris deterministic.
+//!
+//!	The worker index passed to execute can be used to select resources
+//!	(transform buffers, oscillators, scratch space) that are owned by
+//!	that worker. No two jobs are ever executed concurrently by the same
+//!	worker.
+//
+class ParallelTask
+{
+//	-- public interface --
+public:
+
+	//!	Destroy this ParallelTask.
+	virtual ~ParallelTask( void ) {}
+
+	//!	Execute the job having the specified index.
+	//!
+	//!	\param	job is the index of the job to execute, on the range
+	//!			[0, njobs) specified in Parallel::run.
+	//!	\param	worker is the index of the worker executing the job,
+	//!			on the range [0, nworkers) specified in Parallel::run.
+	virtual void execute( long job, unsigned int worker ) = 0;
+
+};	//	end of class ParallelTask
+
+// ---------------------------------------------------------------------------
+//	namespace Parallel
+//
+//	Helpers for executing a ParallelTask using several threads. If Loris
+//	is built without thread support (HAVE_PTHREAD_H is not defined), all
+//	jobs are executed sequentially in the calling thread, by worker 0.
+//
+namespace Parallel {
+
+	//!	Return the number of threads that can run concurrently on this
+	//!	machine, or 1 if that number cannot be determined, or if Loris
+	//!	was built without thread support.
+	unsigned int hardwareThreads( void );
+
+	//!	Return the number of workers that should be used to execute
+	//!	the specified number of jobs, given the requested number of
+	//!	threads. A request for zero threads is interpreted as a request
+	//!	for hardwareThreads(). The result is never larger than the
+	//!	number of jobs, and never smaller than one.
+	//!
+	//!	\param	requested is the requested number of threads, or 0
+	//!	\param	njobs is the number of jobs to execute
+	unsigned int numWorkers( unsigned int requested, long njobs );
+
+	//!	Execute the jobs [0, njobs) of the specified task using
+	//!	(up to) nworkers threads, including the calling thread, and
+	//!	return when all jobs have been executed.
+	//!
+	//!	If any job throws an exception, no further jobs are started,
+	//!	and after all running jobs are finished, the exception raised
+	//!	by the lowest-numbered failing job is re-thrown in the calling
+	//!	thread. Loris exceptions (Loris::Exception and its derived
+	//!	classes) are re-thrown with their original type, so they can
+	//!	be caught in the same way as when the jobs are executed
+	//!	sequentially. std::bad_alloc is re-thrown as std::bad_alloc,
+	//!	and any other exception as a Loris::RuntimeError, preserving
+	//!	its description.
+	//!
+	//!	If some threads cannot be started, the jobs are executed by
+	//!	the threads that were started (at least the calling thread),
+	//!	so that is not an error.
+	//!
+	//!	\param	task is the ParallelTask to execute
+	//!	\param	njobs is the number of jobs to execute
+	//!	\param	nworkers is the number of workers to use, must
+	//!			be positive
+	//!	\throw	InvalidArgument if nworkers is zero.
+	void run( ParallelTask & task, long njobs, unsigned int nworkers );
+
+}	//	end of namespace Parallel
+
+}	//	end of namespace Loris
+
+#endif /* ndef INCLUDE_PARALLEL_H */
@@ -39,13 +39,22 @@
 #include "Breakpoint.h"
 #include "LorisExceptions.h"
 
+//	only the configuration section of loris.h, for LORIS_PARTIAL_MAP:
+#define LORIS_CONFIGURATION_ONLY
+#include "loris.h"
+#undef LORIS_CONFIGURATION_ONLY
+
+#include <iterator>
 #include <map>
+#include <utility>
+#include <vector>
 
 //	begin namespace
 namespace Loris {
 
 class Partial_Iterator;
 class Partial_ConstIterator;
+class PartialCursor;
 
 // ---------------------------------------------------------------------------
 //	class Partial
@@ -69,6 +78,12 @@ class Partial_ConstIterator;
 //!	the Breakpoint (by reference) at the current iterator position and the
 //!	time (by value) corresponding to that Breakpoint.
 //!	
+//!	Breakpoints are stored contiguously, in order of increasing time, 
+//!	so, as with std::vector, inserting or erasing Breakpoints invalidates 
+//!	iterators at and after the point of insertion or removal (and all 
+//!	iterators, if an insertion causes the storage to grow). Use the 
+//!	iterators returned by insert and erase to continue iterating.
+//!	
 //!	Partial is a leaf class, do not subclass.
 //!
 //!	Most of the implementation of Partial delegates to a few
@@ -96,12 +111,19 @@ public:
 //	-- types --
 
 	//!	underlying Breakpoint container type, used by 
-	//!	the iterator types defined below:
-	typedef std::map< double, Breakpoint > container_type;
-	
-	//	typedef std::vector< std::pair< double, Breakpoint > > container_type;
+	//!	the iterator types defined below: a vector of
+	//!	(time, Breakpoint) pairs sorted by time, or, if
+	//!	Loris is configured with --enable-partialmap (the 
+	//!	PARTIAL_MAP option in CMake), a map from time to 
+	//!	Breakpoint. The choice is recorded as LORIS_PARTIAL_MAP 
+	//!	in loris.h.
 	//	see Partial.C for a discussion of issues surrounding the 
-	//	choice of std::map as a Breakpoint container.
+	//	choice of Breakpoint container.
+#if defined(LORIS_PARTIAL_MAP) && LORIS_PARTIAL_MAP
+	typedef std::map< double, Breakpoint > container_type;
+#else
+	typedef std::vector< std::pair< double, Breakpoint > > container_type;
+#endif
 
 	//! 32 bit type for labeling Partials
 	typedef int label_type;	
@@ -437,8 +459,17 @@ public:
 //	-- implementation --
 private:
 
+	//	Return the interpolated parameters of this Partial at the 
+	//	specified time, as parametersAt does, given the position of
+	//	the first Breakpoint not earlier than that time (as returned by
+	//	findAfter), which is only used if the time is strictly between 
+	//	the start and end times of this (non-empty) Partial.
+	Breakpoint interpolate( const_iterator after, double time, double fadeTime ) const;
+
 	label_type _label;
 	container_type _breakpoints;	//	Breakpoint envelope
+	
+	friend class PartialCursor;
 	 
 };	//	end of class Partial
 
@@ -466,7 +497,7 @@ public:
 
 	//! The iterator category, for copmpatibility with 
 	//! C++ standard library algorithms 
-	typedef BaseIterator::iterator_category	iterator_category;
+	typedef std::bidirectional_iterator_tag	iterator_category;
 	
 	//! The type of element that can be accessed through this 
 	//! iterator (Breakpoint).
@@ -642,7 +673,7 @@ public:
 
 	//! The iterator category, for copmpatibility with 
 	//! C++ standard library algorithms 
-	typedef BaseIterator::iterator_category	iterator_category;
+	typedef std::bidirectional_iterator_tag	iterator_category;
 	
 	//! The type of element that can be accessed through this 
 	//! iterator (Breakpoint).
@@ -778,6 +809,73 @@ private:
 
 };	//	end of class Partial_ConstIterator
 
+// ---------------------------------------------------------------------------
+//	class PartialCursor
+//
+//!	A PartialCursor evaluates a Partial at a sequence of times, computing
+//!	exactly the same parameters as Partial::parametersAt, but remembering
+//!	its position in the Breakpoint envelope, so that when the times are
+//!	non-decreasing, each evaluation walks forward from the previous 
+//!	position instead of searching the whole envelope. Evaluating a 
+//!	Partial at n increasing times spread over its m Breakpoints takes
+//!	O(n + m) time, rather than O(n log m). Times that are out of order
+//!	are still evaluated correctly, by searching the envelope.
+//!	
+//!	A PartialCursor refers to, and does not copy, its Partial, which
+//!	must not be modified or destroyed while the cursor is in use.
+//
+class PartialCursor
+{
+//	-- public interface --
+public:
+
+	//!	Construct a cursor on the specified Partial, positioned
+	//!	at its start.
+	//!	
+	//!	\param	p is the Partial to evaluate.
+	explicit PartialCursor( const Partial & p );
+	
+	//	Use compiler-generated copy, assign, and destroy.
+	
+	//!	Return the interpolated parameters of the Partial at the 
+	//!	specified time, exactly as Partial::parametersAt does, and
+	//!	move the cursor to that time.
+	//!	
+	//!	\param	time is the time in seconds at which to evaluate the 
+	//!			Partial.
+	//!	\param	fadeTime is the duration in seconds over which Partial
+	//!			amplitudes fade at the ends. The default value is
+	//!			ShortestSafeFadeTime, 1 ns.
+	//!	\return	A Breakpoint describing the parameters of the Partial 
+	//!			at the specified time.
+	//!	\throw	InvalidPartial if the Partial has no Breakpoints.
+	Breakpoint parametersAt( double time, 
+							 double fadeTime = Partial::ShortestSafeFadeTime );
+	
+	//!	Return the interpolated amplitude of the Partial at the specified
+	//!	time, exactly as Partial::amplitudeAt does, and move the cursor 
+	//!	to that time.
+	double amplitudeAt( double time, double fadeTime = Partial::ShortestSafeFadeTime )
+		{ return parametersAt( time, fadeTime ).amplitude(); }
+	
+	//!	Return the interpolated frequency of the Partial at the specified
+	//!	time, exactly as Partial::frequencyAt does, and move the cursor 
+	//!	to that time.
+	double frequencyAt( double time )
+		{ return parametersAt( time ).frequency(); }
+	
+	//!	Return the Partial evaluated by this cursor.
+	const Partial & partial( void ) const { return *_partial; }
+
+//	-- implementation --
+private:
+
+	const Partial * _partial;
+	Partial::const_iterator _after;	//	first Breakpoint not earlier than _time
+	double _time;					//	time of the most recent evaluation
+	
+};	//	end of class PartialCursor
+
 // ---------------------------------------------------------------------------
 //	class InvalidPartial
 //
@@ -799,7 +897,13 @@ public:
    //!         (generated automatically byt he Throw macro).
 	InvalidPartial( const std::string & str, const std::string & where = "" ) : 
 		InvalidObject( std::string("Invalid Partial -- ").append( str ), where ) {}
-		
+
+	//! Return a new copy of this InvalidPartial, allocated on the heap.
+	InvalidPartial * clone( void ) const { return new InvalidPartial( *this ); }
+
+	//! Throw a copy of this InvalidPartial.
+	void raise( void ) const { throw *this; }
+
 };	//	end of class InvalidPartial
 
 
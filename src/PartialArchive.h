@@ -0,0 +1,352 @@
+#ifndef INCLUDE_PARTIALARCHIVE_H
+#define INCLUDE_PARTIALARCHIVE_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * PartialArchive.h
+ *
+ * Definition of class Loris::PartialArchive, a compact, read-only
+ * encoding of a collection of Partials.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "Breakpoint.h"
+#include "Partial.h"
+#include "PartialList.h"
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+//	begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//	class PartialArchive
+//
+//!	PartialArchive is a compact, read-only encoding of a collection of
+//!	Partials, for keeping large sets of Partials (like analysis corpora
+//!	used for interactive morphing) in memory. Each Breakpoint is stored
+//!	in about 14 bytes, instead of 40 in a Partial:
+//!
+//!	- frequency and amplitude are stored in single precision (float),
+//!	- bandwidth, clamped to [0, 1], is quantized to 16 bits,
+//!	- phase, wrapped to [-pi, pi), is quantized to 16 bits,
+//!	- time is quantized to 1/TimeSteps of a hop time, specified at
+//!	  construction (normally, the hop time used in the analysis), and
+//!	  stored as the difference from the time of the previous Breakpoint
+//!	  in the Partial, using (usually) two bytes.
+//!
+//!	Breakpoint times are accurate to half the quantum, timeResolution(),
+//!	and do not drift, because each time is decoded relative to the
+//!	start of its Partial, which is stored exactly. (Breakpoints closer
+//!	together than the quantum are moved apart, to keep them in order.)
+//!
+//!	Breakpoints are decoded lazily, as the Breakpoints of a Partial are
+//!	traversed using a const_iterator, so the Breakpoints of a Partial
+//!	can be used, for example, to construct an Envelope, without first
+//!	constructing the Partial. Conversion to and from a PartialList
+//!	takes time proportional to the number of Breakpoints.
+//
+class PartialArchive
+{
+//	-- implementation types --
+private:
+
+	//	Breakpoint parameters, encoded, 12 bytes:
+	struct Row
+	{
+		float frequency;
+		float amplitude;
+		unsigned short bandwidth;
+		unsigned short phase;
+	};
+
+//	-- public interface --
+public:
+
+//	-- types --
+
+	//!	type of the Breakpoint and Partial indices and counts
+	typedef std::vector< double >::size_type size_type;
+
+	//!	type of the Partial labels
+	typedef Partial::label_type label_type;
+
+	class const_iterator;
+	friend class const_iterator;
+
+	//!	The number of steps in which a hop time is quantized.
+	enum { TimeSteps = 1024 };
+
+//	-- construction --
+
+	//!	Construct a new empty PartialArchive that quantizes Breakpoint
+	//!	times to 1/TimeSteps of the specified hop time.
+	//!
+	//!	\param	hopTime is the hop time in seconds, normally the
+	//!			hop time used to analyze the Partials.
+	//!	\throw	InvalidArgument if hopTime is not positive.
+	explicit PartialArchive( double hopTime );
+
+	//!	Construct a new PartialArchive that quantizes Breakpoint times
+	//!	to 1/TimeSteps of the specified hop time, from a half-open range
+	//!	of Partials, specified by iterators (like PartialList::iterator)
+	//!	that can be dereferenced to yield Partials.
+	//!
+	//!	\param	b is the beginning of the range of Partials to store.
+	//!	\param	e is the end of the range of Partials to store.
+	//!	\param	hopTime is the hop time in seconds, normally the
+	//!			hop time used to analyze the Partials.
+	//!	\throw	InvalidArgument if hopTime is not positive.
+	template< typename Iter >
+	PartialArchive( Iter b, Iter e, double hopTime );
+
+	//	(allow compiler to generate copy, assignment, and destruction)
+
+//	-- filling and conversion --
+
+	//!	Replace the contents of this PartialArchive with the Partials
+	//!	in a half-open range, specified by iterators (like
+	//!	PartialList::iterator) that can be dereferenced to yield
+	//!	Partials.
+	//!
+	//!	\param	b is the beginning of the range of Partials to store.
+	//!	\param	e is the end of the range of Partials to store.
+	template< typename Iter >
+	void assign( Iter b, Iter e );
+
+	//!	Encode the Breakpoints in the specified Partial, and append
+	//!	them to this PartialArchive, as a new Partial having the same
+	//!	label.
+	//!
+	//!	\param	p is the Partial to append.
+	void append( const Partial & p );
+
+	//!	Remove all Partials from this PartialArchive.
+	void clear( void );
+
+	//!	Return a new Partial constructed by decoding the Breakpoints
+	//!	of the Partial at the specified index.
+	//!
+	//!	\param	k is the index of the Partial to construct.
+	//!	\throw	InvalidArgument if k is out of range.
+	Partial partial( size_type k ) const;
+
+	//!	Return a new PartialList containing all the Partials
+	//!	stored in this archive, decoded, in the same order.
+	PartialList partials( void ) const;
+
+//	-- access --
+
+	//!	Return the number of Partials in this archive.
+	size_type numPartials( void ) const { return mLabels.size(); }
+
+	//!	Return the total number of Breakpoints in this archive.
+	size_type numBreakpoints( void ) const { return mRows.size(); }
+
+	//!	Return the number of Breakpoints in the Partial at
+	//!	the specified index.
+	size_type numBreakpoints( size_type k ) const
+		{ return mRowOffsets[ k + 1 ] - mRowOffsets[ k ]; }
+
+	//!	Return the label of the Partial at the specified index.
+	label_type label( size_type k ) const { return mLabels[ k ]; }
+
+	//!	Set the label of the Partial at the specified index.
+	void setLabel( size_type k, label_type l ) { mLabels[ k ] = l; }
+
+	//!	Return the hop time (in seconds) specified at construction.
+	double hopTime( void ) const { return mHopTime; }
+
+	//!	Return the time (in seconds) to which Breakpoint times are
+	//!	quantized, 1/TimeSteps of the hop time.
+	double timeResolution( void ) const { return mQuantum; }
+
+	//!	Return the number of bytes of memory allocated to store
+	//!	the Partials in this archive (not including the size of
+	//!	the PartialArchive object itself).
+	size_type storageSize( void ) const;
+
+	//!	Return a const_iterator referring to the first Breakpoint
+	//!	of the Partial at the specified index.
+	const_iterator begin( size_type k ) const;
+
+	//!	Return a const_iterator referring to the position past
+	//!	the last Breakpoint of the Partial at the specified index.
+	const_iterator end( size_type k ) const;
+
+//	-- implementation --
+private:
+
+	//	reserve storage for the specified number of
+	//	additional Partials and Breakpoints
+	void reserve( size_type npartials, size_type nbreakpoints );
+
+	//	throw InvalidArgument if the hop time is not positive
+	void checkHopTime( void ) const;
+
+	double mHopTime;						//	hop time, and the time quantum,
+	double mQuantum;						//	mHopTime / TimeSteps
+
+	std::vector< Row > mRows;				//	encoded Breakpoint parameters
+	std::vector< unsigned char > mTimes;	//	encoded Breakpoint times
+
+	std::vector< size_type > mRowOffsets;	//	first row and first time byte of
+	std::vector< size_type > mTimeOffsets;	//	each Partial, and one past the last
+											//	(numPartials()+1 elements each)
+	std::vector< double > mStartTimes;		//	time of the first Breakpoint of
+											//	each Partial
+	std::vector< label_type > mLabels;		//	label of each Partial
+
+};	//	end of class PartialArchive
+
+// ---------------------------------------------------------------------------
+//	class PartialArchive::const_iterator
+//
+//!	Forward iterator over the Breakpoints of a Partial stored in a
+//!	PartialArchive, decoding each Breakpoint (and its time) as it is
+//!	reached. Like Partial::const_iterator, provides access to the
+//!	Breakpoint time (time) as well as the Breakpoint (breakpoint, or
+//!	dereference). The Breakpoint is stored in the iterator, so a
+//!	reference to it is valid only until the iterator is incremented.
+//
+class PartialArchive::const_iterator
+{
+//	-- public interface --
+public:
+
+	//	iterator types:
+	typedef std::forward_iterator_tag	iterator_category;
+	typedef Breakpoint     				value_type;
+	typedef std::ptrdiff_t  			difference_type;
+	typedef const Breakpoint *			pointer;
+	typedef const Breakpoint &			reference;
+
+	//!	Construct an iterator that does not refer to any Breakpoint.
+	const_iterator( void );
+
+	//	(allow compiler to generate copy, assignment, and destruction)
+
+	//!	Return the time (in seconds) of the current Breakpoint.
+	double time( void ) const { return mTime; }
+
+	//!	Return the current (decoded) Breakpoint.
+	const Breakpoint & breakpoint( void ) const { return mBreakpoint; }
+
+	//!	Return the current (decoded) Breakpoint.
+	const Breakpoint & operator*( void ) const { return mBreakpoint; }
+
+	//!	Return a pointer to the current (decoded) Breakpoint.
+	const Breakpoint * operator->( void ) const { return &mBreakpoint; }
+
+	//!	Advance to the next Breakpoint, and decode it.
+	const_iterator & operator++( void );
+
+	//!	Advance to the next Breakpoint, and decode it,
+	//!	returning a copy of this iterator before it was advanced.
+	const_iterator operator++( int );
+
+	//!	Return true if the two iterators refer to the
+	//!	same Breakpoint.
+	friend bool operator==( const const_iterator & lhs, const const_iterator & rhs )
+		{ return lhs.mRow == rhs.mRow; }
+
+	//!	Return true if the two iterators refer to
+	//!	different Breakpoints.
+	friend bool operator!=( const const_iterator & lhs, const const_iterator & rhs )
+		{ return lhs.mRow != rhs.mRow; }
+
+//	-- implementation --
+private:
+
+	friend class PartialArchive;
+
+	//	Construct an iterator referring to the specified row, decoding
+	//	times starting at the specified byte, relative to the specified
+	//	start time. (Do not decode anything if row is end.)
+	const_iterator( const Row * row, const Row * end,
+					const unsigned char * time,
+					double startTime, double quantum );
+
+	//	decode the current row and its time
+	void decode( void );
+
+	const Row * mRow;					//	current and last rows
+	const Row * mEnd;
+	const unsigned char * mTimeCode;	//	time code of the next row
+	double mStartTime;					//	time of the first Breakpoint
+	double mQuantum;					//	time quantum
+	double mSteps;						//	quanta since mStartTime (an integer)
+
+	double mTime;						//	decoded time and Breakpoint
+	Breakpoint mBreakpoint;
+
+};	//	end of class PartialArchive::const_iterator
+
+// ---------------------------------------------------------------------------
+//	constructor from range
+// ---------------------------------------------------------------------------
+//
+template< typename Iter >
+PartialArchive::PartialArchive( Iter b, Iter e, double hopTime ) :
+	mHopTime( hopTime ),
+	mQuantum( hopTime / TimeSteps ),
+	mRowOffsets( 1, 0 ),
+	mTimeOffsets( 1, 0 )
+{
+	checkHopTime();
+	assign( b, e );
+}
+
+// ---------------------------------------------------------------------------
+//	assign
+// ---------------------------------------------------------------------------
+//	Count the Breakpoints first, so that the rows are allocated
+//	only once.
+//
+template< typename Iter >
+void PartialArchive::assign( Iter b, Iter e )
+{
+	clear();
+
+	size_type npartials = 0, nbreakpoints = 0;
+	for ( Iter it = b; it != e; ++it )
+	{
+		++npartials;
+		nbreakpoints += it->numBreakpoints();
+	}
+	reserve( npartials, nbreakpoints );
+
+	while ( b != e )
+	{
+		append( *b++ );
+	}
+}
+
+}	//	end of namespace Loris
+
+#endif /* ndef INCLUDE_PARTIALARCHIVE_H */
@@ -47,12 +47,34 @@
 #include "SpectralPeaks.h"
 
 #include <memory>
+#include <vector>
 
 //	begin namespace
 namespace Loris {
 
 class Envelope;
 
+// ---------------------------------------------------------------------------
+//	class RetiredPartialSink
+//
+//	Abstract base class for receivers of the Partials retired by a 
+//	PartialBuilder, that is, the Partials that can no longer be extended.
+//
+class RetiredPartialSink
+{
+public:
+
+	//	destructor
+	virtual ~RetiredPartialSink( void ) {}
+	
+    //  retire
+    //
+	//	Receive the (non-empty) list of Partials retired after a frame,
+	//	in the order in which they were created. The Partials may be
+	//	spliced into another list, those left in the list are destroyed.
+	virtual void retire( PartialList & retired ) = 0;
+};
+
 // ---------------------------------------------------------------------------
 //	class PartialBuilder
 //
@@ -95,21 +117,40 @@ public:
 
     //  finishBuilding
     //
-	//	Return the Partials that were built. After calling finishBuilding, the
-    //  builder is returned to its initial state, and ready to build another
-    //  set of Partials. 
+	//	Return the Partials that were built (and not retired to a sink),
+	//	moved, not copied, out of the builder. After calling finishBuilding, 
+	//	the builder is returned to its initial state, and ready to build 
+	//	another set of Partials. 
 	PartialList finishBuilding( void );
+	
+	//	setRetiredPartialSink
+	//
+	//	Specify a sink to receive the Partials that can no longer be 
+	//	extended, as soon as they are retired at the end of each call
+	//	to buildPartials, so that the builder retains only the Partials
+	//	that are still being built. If the sink is 0 (the default), all
+	//	Partials are retained until finishBuilding is called. The sink 
+	//	is not owned by the builder.
+	void setRetiredPartialSink( RetiredPartialSink * sink );
+	
+    //  retireFinished
+    //
+	//	Move the Partials that can no longer be extended, that is, those
+	//	that were not extended by the most recent call to buildPartials, 
+	//	to the end of the specified PartialList, in the order in which 
+	//	they were created. Partials still being built are not affected.
+	void retireFinished( PartialList & finished );
 
 private:
 
 // --- auxiliary member functions ---
 
-    double warped_freq_distance( const Partial & partial, const SpectralPeak & pk );
+    void compute_warped_frequencies( const Peaks & peaks );
 
-    bool better_match( const Partial & part, const SpectralPeak & pk1,
-		   	           const SpectralPeak & pk2 );
-    bool better_match( const Partial & part1, 
-	  		           const Partial & part2, const SpectralPeak & pk );                       
+    double warped_freq_distance( long partialIdx, long peakIdx ) const;
+
+    bool better_peak_match( long partialIdx, long peakIdx1, long peakIdx2 ) const;
+    bool better_partial_match( long partialIdx1, long partialIdx2, long peakIdx ) const;
                        
                        
 // --- collected partials ---
@@ -120,10 +161,15 @@ private:
 		
 	PartialPtrs mEligiblePartials;
     PartialPtrs mNewlyEligible;                 // 	keep track of eligible partials here
+    
+    std::vector< double > mWarpedPeakFreqs;     //  warped frequencies of the peaks and
+    std::vector< double > mWarpedEligibleFreqs; //  eligible partials in the current frame
 
 // --- parameters ---
     	
 	std::auto_ptr< Envelope > mFreqWarping;	//	reference envelope
+	
+	RetiredPartialSink * mRetiredSink;      //  receives retired Partials, or 0
     
 	double mFreqDrift;
     	
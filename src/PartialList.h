@@ -54,7 +54,9 @@ namespace Loris {
 //! copying. Specialization of the template cone function in PtrCopyOnWrite.h.
 //! This is the operation that is invoked when the underlying container needs
 //! to be duplicated, any time non-const access is required of a shared 
-//! instance.
+//! instance, unless the container was allocated together with its reference
+//! count (by Ptr::make, as in PartialList), in which case it is copied 
+//! directly.
 //
 template <> 
 inline std::list< Partial > * 
@@ -121,8 +123,9 @@ public:
 #else
     PartialList( iterator b, iterator e ) :
 #endif
-        mList( new list_of_Partials_type( b, e ) )
+        mList( list_ptr_type::make() )
     {
+        mList->insert( mList->end(), b, e );
     }
     
     //! Construct a PartialList that is a copy of another.
@@ -144,6 +147,23 @@ public:
     //! member function).
     PartialList & operator=( const PartialList & rhs );
     
+#if __cplusplus >= 201103L
+    //! Construct a PartialList that takes over the Partials of
+    //! another, leaving it empty. No Partials are copied.
+    PartialList( PartialList && rhs );
+    
+    //! Take over the Partials of another PartialList, leaving it
+    //! with the former contents of this PartialList. No Partials 
+    //! are copied.
+    PartialList & operator=( PartialList && rhs );
+#endif
+
+    //! Exchange the contents of this PartialList with another.
+    //! No Partials are copied, and neither list triggers a copy of
+    //! Partials shared with another PartialList. This is the 
+    //! cheapest way to transfer Partials between PartialLists.
+    void swap( PartialList & other ) { mList.swap( other.mList ); }
+    
     
 //  --- access and mutation ---    
     
@@ -234,7 +254,7 @@ public:
         //  Partials are shared with another PartialList, clear will
         //  trigger a copy immediately before erasing all of the 
         //  Partials.
-        mList = list_ptr_type( new list_of_Partials_type );
+        mList = list_ptr_type::make();
     }
 
 
@@ -329,6 +349,16 @@ public:
     
 };  //   end of class PartialList
 
+// ---------------------------------------------------------------------------
+//	swap (non-member)
+// ---------------------------------------------------------------------------
+//! Exchange the contents of two PartialLists, without copying
+//! any Partials.
+//
+inline void swap( PartialList & a, PartialList & b )
+{
+    a.swap( b );
+}
 
 
 // --- typedefs for iterators ---
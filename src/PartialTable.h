@@ -0,0 +1,243 @@
+#ifndef INCLUDE_PARTIALTABLE_H
+#define INCLUDE_PARTIALTABLE_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * PartialTable.h
+ *
+ * Definition of class Loris::PartialTable, a packed, columnar
+ * representation of a collection of Partials.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "Partial.h"
+#include "PartialList.h"
+
+#include <vector>
+
+//	begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//	class PartialTable
+//
+//!	PartialTable is a packed, columnar (structure-of-arrays) representation
+//!	of a collection of Partials. The times and the frequency, amplitude,
+//!	bandwidth, and phase parameters of all the Breakpoints in the collection
+//!	are stored in five contiguous arrays (columns), one row per Breakpoint.
+//!	The rows for each Partial are contiguous and in order of increasing
+//!	time, and the Partials are stored in the order in which they were
+//!	added to the table. The rows for the Partial at index k are
+//!	[partialBegin(k), partialEnd(k)).
+//!
+//!	PartialTable is meant for bulk numeric processing of Partial
+//!	parameters, such as the PartialUtils mutators, that would otherwise
+//!	have to traverse a list of Partials and their Breakpoint envelopes.
+//!	Conversion to and from a PartialList takes time proportional to
+//!	the number of Breakpoints.
+//!
+//!	The parameter columns can be modified freely through the non-const
+//!	column accessors, but Breakpoint times in each Partial must remain
+//!	in increasing order (more than 1 ns apart), or else Breakpoints may be
+//!	lost when the table is converted back to Partials.
+//
+class PartialTable
+{
+//	-- public interface --
+public:
+
+//	-- types --
+
+	//!	type of the row and Partial indices and counts
+	typedef std::vector< double >::size_type size_type;
+
+	//!	type of the Partial labels
+	typedef Partial::label_type label_type;
+
+//	-- construction --
+
+	//!	Construct a new empty PartialTable.
+	PartialTable( void );
+
+	//!	Construct a new PartialTable from a half-open range of Partials,
+	//!	specified by iterators (like PartialList::iterator) that can be
+	//!	dereferenced to yield Partials.
+	//!
+	//!	\param	b is the beginning of the range of Partials to store.
+	//!	\param	e is the end of the range of Partials to store.
+	template< typename Iter >
+	PartialTable( Iter b, Iter e ) { assign( b, e ); }
+
+	//	(allow compiler to generate copy, assignment, and destruction)
+
+//	-- filling and conversion --
+
+	//!	Replace the contents of this PartialTable with the Partials
+	//!	in a half-open range, specified by iterators (like
+	//!	PartialList::iterator) that can be dereferenced to yield
+	//!	Partials.
+	//!
+	//!	\param	b is the beginning of the range of Partials to store.
+	//!	\param	e is the end of the range of Partials to store.
+	template< typename Iter >
+	void assign( Iter b, Iter e );
+
+	//!	Append the Breakpoints in the specified Partial to this
+	//!	PartialTable, as a new Partial having the same label.
+	//!
+	//!	\param	p is the Partial to append.
+	void append( const Partial & p );
+
+	//!	Remove all Partials from this PartialTable.
+	void clear( void );
+
+	//!	Return a new Partial constructed from the rows of
+	//!	this table for the Partial at the specified index.
+	//!
+	//!	\param	k is the index of the Partial to construct.
+	//!	\throw	InvalidArgument if k is out of range.
+	Partial partial( size_type k ) const;
+
+	//!	Return a new PartialList containing all the Partials
+	//!	stored in this table, in the same order.
+	PartialList partials( void ) const;
+
+//	-- access --
+
+	//!	Return the number of Partials in this table.
+	size_type numPartials( void ) const { return mLabels.size(); }
+
+	//!	Return the total number of Breakpoints (rows) in this table.
+	size_type numBreakpoints( void ) const { return mTimes.size(); }
+
+	//!	Return the index of the first row for the Partial at
+	//!	the specified index.
+	size_type partialBegin( size_type k ) const { return mOffsets[ k ]; }
+
+	//!	Return the index one past the last row for the Partial
+	//!	at the specified index.
+	size_type partialEnd( size_type k ) const { return mOffsets[ k + 1 ]; }
+
+	//!	Return the label of the Partial at the specified index.
+	label_type label( size_type k ) const { return mLabels[ k ]; }
+
+	//!	Set the label of the Partial at the specified index.
+	void setLabel( size_type k, label_type l ) { mLabels[ k ] = l; }
+
+	//!	Return a pointer to the first element in the column of Breakpoint
+	//!	times (in seconds), or 0 if the table is empty.
+	double * times( void ) { return column( mTimes ); }
+
+	//!	Return a pointer to the first element in the column of Breakpoint
+	//!	times (in seconds), or 0 if the table is empty.
+	const double * times( void ) const { return column( mTimes ); }
+
+	//!	Return a pointer to the first element in the column of Breakpoint
+	//!	frequencies (in Hz), or 0 if the table is empty.
+	double * frequencies( void ) { return column( mFrequencies ); }
+
+	//!	Return a pointer to the first element in the column of Breakpoint
+	//!	frequencies (in Hz), or 0 if the table is empty.
+	const double * frequencies( void ) const { return column( mFrequencies ); }
+
+	//!	Return a pointer to the first element in the column of Breakpoint
+	//!	amplitudes, or 0 if the table is empty.
+	double * amplitudes( void ) { return column( mAmplitudes ); }
+
+	//!	Return a pointer to the first element in the column of Breakpoint
+	//!	amplitudes, or 0 if the table is empty.
+	const double * amplitudes( void ) const { return column( mAmplitudes ); }
+
+	//!	Return a pointer to the first element in the column of Breakpoint
+	//!	bandwidths, or 0 if the table is empty.
+	double * bandwidths( void ) { return column( mBandwidths ); }
+
+	//!	Return a pointer to the first element in the column of Breakpoint
+	//!	bandwidths, or 0 if the table is empty.
+	const double * bandwidths( void ) const { return column( mBandwidths ); }
+
+	//!	Return a pointer to the first element in the column of Breakpoint
+	//!	phases (in radians), or 0 if the table is empty.
+	double * phases( void ) { return column( mPhases ); }
+
+	//!	Return a pointer to the first element in the column of Breakpoint
+	//!	phases (in radians), or 0 if the table is empty.
+	const double * phases( void ) const { return column( mPhases ); }
+
+//	-- implementation --
+private:
+
+	//	reserve storage for the specified number of
+	//	additional Partials and Breakpoints
+	void reserve( size_type npartials, size_type nbreakpoints );
+
+	static double * column( std::vector< double > & v )
+		{ return v.empty() ? 0 : &v[0]; }
+	static const double * column( const std::vector< double > & v )
+		{ return v.empty() ? 0 : &v[0]; }
+
+	std::vector< double > mTimes;			//	Breakpoint parameter columns,
+	std::vector< double > mFrequencies;		//	one row per Breakpoint
+	std::vector< double > mAmplitudes;
+	std::vector< double > mBandwidths;
+	std::vector< double > mPhases;
+
+	std::vector< size_type > mOffsets;		//	first row of each Partial, and
+											//	one past the last row of the
+											//	last Partial (numPartials()+1
+											//	elements)
+	std::vector< label_type > mLabels;		//	label of each Partial
+
+};	//	end of class PartialTable
+
+// ---------------------------------------------------------------------------
+//	assign
+// ---------------------------------------------------------------------------
+//	Count the Breakpoints first, so that the columns are allocated
+//	only once.
+//
+template< typename Iter >
+void PartialTable::assign( Iter b, Iter e )
+{
+	clear();
+
+	size_type npartials = 0, nbreakpoints = 0;
+	for ( Iter it = b; it != e; ++it )
+	{
+		++npartials;
+		nbreakpoints += it->numBreakpoints();
+	}
+	reserve( npartials, nbreakpoints );
+
+	while ( b != e )
+	{
+		append( *b++ );
+	}
+}
+
+}	//	end of namespace Loris
+
+#endif /* ndef INCLUDE_PARTIALTABLE_H */
@@ -49,6 +49,8 @@
 //	begin namespace
 namespace Loris {
 
+class PartialTable;
+
 namespace PartialUtils {
 
 //	-- Partial mutating functors --
@@ -90,6 +92,25 @@ public:
 	//! member.
 	virtual void operator()( Partial & p ) const = 0;
 
+	//! Function call operator: apply a mutation factor to all the
+	//! Partials stored in the specified PartialTable. The default
+	//! implementation converts the table to Partials, mutates them,
+	//! and stores them back in the table. Derived classes should
+	//! override this member to operate on the table columns directly.
+	//!
+	//! A derived class that overrides only operator()( Partial & )
+	//! hides this member. Such a class should declare
+	//! using PartialMutator::operator(); or else the mutator can
+	//! be applied to a PartialTable using applyTo.
+	virtual void operator()( PartialTable & t ) const;
+
+	//! Apply a mutation factor to all the Partials stored in the
+	//! specified PartialTable. Equivalent to the PartialTable function
+	//! call operator, but never hidden by derived classes.
+	//!
+	//! \param	t is the PartialTable to mutate.
+	void applyTo( PartialTable & t ) const;
+
 protected:
 
 	//! pointer to an envelope that governs the 
@@ -117,6 +138,10 @@ public:
 	//! Function call operator: apply a scale factor to the specified
 	//! Partial.
 	void operator()( Partial & p ) const;
+
+	//! Function call operator: apply a scale factor to all the
+	//! Partials stored in the specified PartialTable.
+	void operator()( PartialTable & t ) const;
 };
 
 // ---------------------------------------------------------------------------
@@ -177,6 +202,10 @@ public:
 	//! Function call operator: apply a scale factor to the specified
 	//! Partial.
 	void operator()( Partial & p ) const;
+
+	//! Function call operator: apply a scale factor to all the
+	//! Partials stored in the specified PartialTable.
+	void operator()( PartialTable & t ) const;
 };
 
 // ---------------------------------------------------------------------------
@@ -237,6 +266,10 @@ public:
 	//! Function call operator: assign a bw factor to the specified
 	//! Partial.
 	void operator()( Partial & p ) const;
+
+	//! Function call operator: assign a bw factor to all the
+	//! Partials stored in the specified PartialTable.
+	void operator()( PartialTable & t ) const;
 };
 
 // ---------------------------------------------------------------------------
@@ -297,6 +330,10 @@ public:
 	//! Function call operator: apply a scale factor to the specified
 	//! Partial.
 	void operator()( Partial & p ) const;
+
+	//! Function call operator: apply a scale factor to all the
+	//! Partials stored in the specified PartialTable.
+	void operator()( PartialTable & t ) const;
 };
 
 // ---------------------------------------------------------------------------
@@ -357,6 +394,10 @@ public:
 	//! Function call operator: apply a scale factor to the specified
 	//! Partial.
 	void operator()( Partial & p ) const;
+
+	//! Function call operator: apply a scale factor to all the
+	//! Partials stored in the specified PartialTable.
+	void operator()( PartialTable & t ) const;
 };
 
 // ---------------------------------------------------------------------------
@@ -418,6 +459,10 @@ public:
 	//! Function call operator: apply a scale factor to the specified
 	//! Partial.
 	void operator()( Partial & p ) const;
+
+	//! Function call operator: apply a scale factor to all the
+	//! Partials stored in the specified PartialTable.
+	void operator()( PartialTable & t ) const;
 };
 
 // ---------------------------------------------------------------------------
@@ -487,6 +532,10 @@ public:
     //! cropping occurs.
 	void operator()( Partial & p ) const;
 	
+	//! Function call operator: crop all the Partials stored in 
+	//! the specified PartialTable.
+	void operator()( PartialTable & t ) const;
+	
 private:
 	double minTime, maxTime;
 };
@@ -555,6 +604,10 @@ public:
 	//! Function call operator: apply a time shift to the specified
 	//! Partial.
 	void operator()( Partial & p ) const;
+
+	//! Function call operator: apply a time shift to all the
+	//! Partials stored in the specified PartialTable.
+	void operator()( PartialTable & t ) const;
 	
 private:
 	double offset;
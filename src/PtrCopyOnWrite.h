@@ -37,15 +37,111 @@
 #include <cstddef>
 #include <stdexcept>
 
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
 
 //  begin namespace
 namespace Loris {
 
+// ---------------------------------------------------------------------------
+//  class PtrRefCount
+//
+//! Reference count shared by the Ptrs that refer to the same resource.
+//! The count is updated atomically, so that Ptrs sharing a resource
+//! can be copied, assigned, and destroyed in different threads. 
+//! Decrementing the count has release and acquire semantics, so the 
+//! thread that releases the last reference sees all changes made to 
+//! the resource by other threads before they released theirs.
+//!
+//! If the compiler provides no atomic operations (neither the GCC 
+//! __atomic builtins nor the MSVC interlocked intrinsics), the count
+//! is updated non-atomically, and Ptrs sharing a resource must not be
+//! used in different threads.
+
+class PtrRefCount
+{
+public:
+
+    //! Construct a new reference count, counting one reference.
+    PtrRefCount( void ) : mCount( 1 ) { }
+    
+    //! Count another reference.
+    void increment( void )
+    {
+#if defined(__ATOMIC_ACQ_REL)
+        __atomic_add_fetch( &mCount, 1, __ATOMIC_RELAXED );
+#elif defined(_MSC_VER)
+        _InterlockedIncrement( &mCount );
+#else
+        ++mCount;
+#endif
+    }
+    
+    //! Release a reference, and return the number of references 
+    //! remaining.
+    long decrement( void )
+    {
+#if defined(__ATOMIC_ACQ_REL)
+        return __atomic_sub_fetch( &mCount, 1, __ATOMIC_ACQ_REL );
+#elif defined(_MSC_VER)
+        return _InterlockedDecrement( &mCount );
+#else
+        return --mCount;
+#endif
+    }
+    
+    //! Return true if there is only one reference. If so, that
+    //! reference is the only one that can ever be used to modify 
+    //! the resource.
+    bool unique( void ) const
+    {
+#if defined(__ATOMIC_ACQ_REL)
+        return 1 == __atomic_load_n( &mCount, __ATOMIC_ACQUIRE );
+#else
+        return 1 == mCount;
+#endif
+    }
+    
+private:
+
+#if defined(_MSC_VER)
+    volatile long mCount;   //! number of references
+#else
+    long mCount;            //! number of references
+#endif
+    
+};  //  end of class PtrRefCount
+
+// ---------------------------------------------------------------------------
+//  clone - default template implementation
+// ---------------------------------------------------------------------------
+//  Implement this function for any managed (by Ptr) type that does not 
+//  support a clone() operation.
+//
+template <class T> T* clone(const T* tp)
+{
+    return tp->clone();
+}
+
 // ---------------------------------------------------------------------------
 //  template class Ptr
 //
 //! Reference counting smart pointer template class supporting copy-on-write 
 //! semantics, mostly copied from Koenig and Moo, Accelerated C++.
+//!
+//! The reference count is atomic (see PtrRefCount), so different Ptrs
+//! sharing a resource may be used in different threads, and each will 
+//! copy the resource before modifying it if (and only if) it is still 
+//! shared. As with the built-in pointers, a single Ptr must not be 
+//! modified in one thread while it is used in another, and a shared 
+//! resource must not be modified except through a Ptr.
+//!
+//! A resource constructed by make() is allocated together with its 
+//! reference count, and so is its copy when it is duplicated by 
+//! make_unique. A resource passed to the constructor is allocated 
+//! separately from its count, and is duplicated using clone().
     
 template <class T> class Ptr 
 {
@@ -55,15 +151,56 @@ public:
 //  --- lifecycle ---
     
     //! Construct a new pointer to nothing
-    Ptr(): refptr(new size_t(1)), p(0) { }
+    Ptr(): refptr(0), p(0) { }
     
     //! Construct a new pointer an initialize it to point to something, 
     //! first counted reference.
-    Ptr(T* t): refptr(new size_t(1)), p(t) { }
+    Ptr(T* t): refptr(0), p(t) 
+    { 
+        if (t)
+        {
+            try
+            {
+                refptr = new Separate(t);
+            }
+            catch( ... )
+            {
+                delete t;
+                throw;
+            }
+        }
+    }
     
     //! Construct a new pointer and initialize it to point to a shared
     //! resource, increment the reference count.
-    Ptr(const Ptr& h): refptr(h.refptr), p(h.p) { ++*refptr; }
+    Ptr(const Ptr& h): refptr(h.refptr), p(h.p) 
+    { 
+        if (refptr)
+        {
+            refptr->count.increment(); 
+        }
+    }
+
+#if __cplusplus >= 201103L
+    //! Construct a new pointer that takes over the resource shared by
+    //! h, leaving h bound to nothing, without changing the reference
+    //! count.
+    Ptr(Ptr&& h): refptr(h.refptr), p(h.p) { h.refptr = 0; h.p = 0; }
+
+    //! Move assignment
+    //! Release any previously-managed resources, if there were no other 
+    //! references, and take over the resource shared by rhs, leaving 
+    //! rhs bound to nothing.
+    Ptr& operator=(Ptr&& rhs) { Ptr(static_cast<Ptr&&>(rhs)).swap(*this); return *this; }
+#endif
+    
+    //! Return a new pointer to a new default-constructed object,
+    //! allocated together with its reference count.
+    static Ptr make( void ) { return bind( new Together ); }
+
+    //! Return a new pointer to a new copy of an object, allocated
+    //! together with its reference count.
+    static Ptr make( const T& t ) { return bind( new Together(t) ); }
 
     //! Assignment
     //! Release any previously-managed resources, if there were no other 
@@ -73,7 +210,16 @@ public:
     //! Destructor
     //! Release any managed resources, if there were no other references, 
     //! otherwise just decrement the reference count.
-    ~Ptr();                        
+    ~Ptr() { release(refptr); }
+    
+    //! Exchange the resources of two pointers, without changing 
+    //! any reference counts. (This is the cheapest way to transfer 
+    //! a resource from one Ptr to another.)
+    void swap(Ptr& other)
+    {
+        Block* b = refptr; refptr = other.refptr; other.refptr = b;
+        T* t = p; p = other.p; other.p = t;
+    }
     
     //! Conversion to bool, return true if Ptr is bound to some object,
     //! false otherwise.
@@ -104,49 +250,119 @@ private:
     
     //	-- implementation --
 
-    T* p;                   //! managed resource
+    //  Reference count of a shared resource, and the owner of that
+    //  resource, destroying it when the count is released for the 
+    //  last time.
+    struct Block
+    {
+        PtrRefCount count;
+        
+        virtual ~Block() { }
+        
+        //  Return a new Block owning a copy of the resource, 
+        //  and store a pointer to the copy in t.
+        virtual Block* copy(T*& t) const = 0;
+    };
+    
+    //  Block owning a resource allocated separately.
+    struct Separate : public Block
+    {
+        T* object;
+        
+        explicit Separate(T* t): object(t) { }
+        ~Separate() { delete object; }
+        
+        Block* copy(T*& t) const
+        {
+            T* c = clone(static_cast<const T*>(object));
+            try
+            {
+                Block* b = new Separate(c);
+                t = c;
+                return b;
+            }
+            catch( ... )
+            {
+                delete c;
+                throw;
+            }
+        }
+    };
     
+    //  Block containing its resource, a single allocation.
+    struct Together : public Block
+    {
+        T object;
+        
+        Together(): object() { }
+        explicit Together(const T& t): object(t) { }
+        
+        Block* copy(T*& t) const
+        {
+            Together* b = new Together(object);
+            t = &b->object;
+            return b;
+        }
+    };
     
-#ifdef _MSC_VER
-    size_t* refptr;         //! shared reference counter
-#else
-    std::size_t* refptr;    //! shared reference counter
-#endif
+    //  Return a new pointer to the resource in a Together,
+    //  first counted reference.
+    static Ptr bind(Together* b)
+    {
+        Ptr ptr;
+        ptr.refptr = b;
+        ptr.p = &b->object;
+        return ptr;
+    }
     
-
+    //  Release a reference to the resource owned by b, 
+    //  destroying it if there are no other references.
+    static void release(Block* b)
+    {
+        if (b && 0 == b->count.decrement()) 
+        {
+            delete b;
+        }
+    }
+    
+    Block* refptr;          //! shared reference counter and resource owner
+    T* p;                   //! managed resource
     
     //! Private member to copy the shared resource 
     //! conditionally when needed. Invoked automatically
     //! when (before) non-const access is granted.
     //! Invokes template clone() function (non-member) which
-    //! must be implemented for the managed type. Default
+    //! must be implemented for the managed type (unless the 
+    //! resource was constructed by make()). Default
     //! implementation invokes a clone() member function.
+    //!
+    //! The copy is made before the reference to the shared
+    //! resource is released, and the shared resource is destroyed
+    //! if all the other references were released in the meantime.
     void make_unique( void ) 
     {
-        if (*refptr != 1) 
+        if (refptr && !refptr->count.unique()) 
         {
-            --*refptr;
-            refptr = new size_t(1);
-            p = p? clone(p): 0;
+            Block* shared = refptr;
+            refptr = shared->copy(p);
+            release(shared);
         }
     }
     
 };  //  end of class Ptr
     
-
 // ---------------------------------------------------------------------------
-//  clone - default template implementation
+//  swap (non-member)
 // ---------------------------------------------------------------------------
-//  Implement this function for any managed (by Ptr) type that does not 
-//  support a clone() operation.
+//! Exchange the resources of two pointers, without changing 
+//! any reference counts.
 //
-template <class T> T* clone(const T* tp)
+template<class T>
+inline void swap( Ptr<T>& a, Ptr<T>& b )
 {
-    return tp->clone();
+    a.swap(b);
 }
 
-
-
 // ---------------------------------------------------------------------------
 //  pointer dereference 
 // ---------------------------------------------------------------------------
@@ -199,41 +415,16 @@ const T* Ptr<T>::operator->( void ) const
 //  assignment 
 // ---------------------------------------------------------------------------
 //  Release any previously-managed resources, if there were no other 
-//  references, and share a reference to a resource with rhs.
+//  references, and share a reference to a resource with rhs. Sharing 
+//  rhs first makes self-assignment safe.
 //
 template<class T>
 Ptr<T>& Ptr<T>::operator=( const Ptr& rhs )
 {
-    ++*rhs.refptr;
-    // free the lhs, destroying pointers if appropriate
-    if (--*refptr == 0) 
-    {
-        delete refptr;
-        delete p;
-    }
-
-    // copy in values from the right-hand side
-    refptr = rhs.refptr;
-    p = rhs.p;
+    Ptr(rhs).swap(*this);
     return *this;
 }
 
-// ---------------------------------------------------------------------------
-//  destructor 
-// ---------------------------------------------------------------------------
-//  Release any managed resources, if there were no other references, 
-//  otherwise just decrement the reference count.
-//
-template<class T> Ptr<T>::~Ptr()
-{
-    if (--*refptr == 0) 
-    {
-        delete refptr;
-        delete p;
-    }
-}
-
 }   //  end of namespace Loris
 
 #endif  /* def INCLUDE_PTRCOPYONWRITE_H */
-
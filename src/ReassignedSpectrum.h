@@ -58,14 +58,28 @@ public:
     //! Construct a new instance using the specified short-time window.
     //!	Transform lengths are the smallest power of two greater than twice the
     //!	window length.
-	ReassignedSpectrum( const std::vector< double > & window );
+    //!
+    //! If useRealTransforms is true, the four windowed transforms are 
+    //! computed as separate real-to-complex transforms, storing only
+    //! the non-negative frequency samples, instead of as pairs of real
+    //! transforms packed into two complex transforms. The reassigned
+    //! values are the same, up to round-off. The default is false.
+	ReassignedSpectrum( const std::vector< double > & window,
+                        bool useRealTransforms = false );
 
     //! Construct a new instance using the specified short-time window and
     //! its time derivative.
     //!	Transform lengths are the smallest power of two greater than twice the
     //!	window length.
+    //!
+    //! If useRealTransforms is true, the four windowed transforms are 
+    //! computed as separate real-to-complex transforms, storing only
+    //! the non-negative frequency samples, instead of as pairs of real
+    //! transforms packed into two complex transforms. The reassigned
+    //! values are the same, up to round-off. The default is false.
 	ReassignedSpectrum( const std::vector< double > & window,
-                        const std::vector< double > & windowDerivative );
+                        const std::vector< double > & windowDerivative,
+                        bool useRealTransforms = false );
     
 	// compiler-generated copy, assign, and destroy are sufficient
 
@@ -86,7 +100,9 @@ public:
     //! \pre    sampsEnd must be past sampCenter
     //! \post   the transform buffers store the reassigned 
     //!         short-time transform data for the specified 
-    //!         samples
+    //!         samples, and the reassigned frequencies, times,
+    //!         and magnitudes have been computed for all frequency
+    //!         samples from 0 to size()/2
 	void transform( const double * sampsBegin, const double * pos, const double * sampsEnd );
 	
 //	--- inquiry ---
@@ -98,6 +114,11 @@ public:
     //!	(Peers may need to know about the analysis window
     //!	or about the scale factors in introduces.)
 	const std::vector< double > & window( void ) const;
+
+    //! Return true if this ReassignedSpectrum computes real-to-complex
+    //! transforms, and false if it packs pairs of real transforms into
+    //! complex transforms.
+    bool usesRealTransforms( void ) const;
 	
 
 //	--- reassigned transform access ---
@@ -141,6 +162,25 @@ public:
     //!         transform
 	double reassignedTime( long idx ) const;
 
+//	--- reassigned transform arrays ---
+
+    //! Return the reassigned frequencies in fractional frequency
+    //! samples, computed by the most recent transform at every 
+    //! frequency sample from 0 to size()/2 (inclusive). Element k
+    //! is equal to reassignedFrequency( k ).
+	const std::vector< double > & reassignedFrequencies( void ) const;
+
+    //! Return the reassigned times in fractional samples, computed 
+    //! by the most recent transform at every frequency sample from 
+    //! 0 to size()/2 (inclusive). Element k is equal to 
+    //! reassignedTime( k ).
+	const std::vector< double > & reassignedTimes( void ) const;
+
+    //! Return the spectrum magnitudes, computed by the most recent 
+    //! transform at every frequency sample from 0 to size()/2 
+    //! (inclusive). Element k is equal to reassignedMagnitude( k ).
+	const std::vector< double > & reassignedMagnitudes( void ) const;
+
 //	--- reassignment operations ---
 	
     //!	Compute the frequency correction at the specified frequency sample
@@ -181,6 +221,22 @@ public:
 	
 private:
 
+//	-- transform access helpers --
+
+    //  Return the transforms of the samples windowed by 
+    //  W(n), W'(n), nW(n), and nW'(n), at the specified
+    //  frequency sample, which may be negative, or larger
+    //  than the transform length (the transforms are periodic).
+    std::complex< double > transformW( long idx ) const;
+    std::complex< double > transformWd( long idx ) const;
+    std::complex< double > transformWt( long idx ) const;
+    std::complex< double > transformWtd( long idx ) const;
+
+    //  Compute the reassigned frequencies, times, and magnitudes
+    //  at all frequency samples from 0 to size()/2, in one pass
+    //  over the transform data.
+    void computeReassignment( void );
+
 //	-- window building helpers --
 
     //	Build a pair of complex-valued windows, one having the frequency-ramp 
@@ -205,11 +261,14 @@ private:
 
 //	-- instance variables --
 
-	//! the FourierTransform for computing magnitude and phase
-	FourierTransform mMagnitudeTransform;
+	//! the FourierTransforms for computing magnitude and phase (first), 
+	//! and time and frequency corrections (second), empty if using 
+	//! real transforms
+	std::vector< FourierTransform > mCplxTransforms;
 	
-	//! the FourierTransform for computing time and frequency corrections
-	FourierTransform mCorrectionTransform;
+	//! the RealFourierTransforms of the samples windowed by W(n), W'(n), 
+	//! nW(n), and nW'(n), in that order, empty unless using real transforms
+	std::vector< RealFourierTransform > mRealTransforms;
 	
 	//! the original short-time analysis window samples
 	std::vector< double > mWindow;                          //  W(n)
@@ -221,6 +280,12 @@ private:
 	//! the complex window used to compute the 
     //! time/frequency correction transform
 	std::vector< std::complex< double > > mCplxWin_Wd_Wt;   //  real W'(n), imag nW(n)
+	
+	//! the reassigned frequencies, times, and magnitudes computed
+	//! by the most recent transform, at frequency samples 0 to size()/2
+	std::vector< double > mReassignedFreqs;
+	std::vector< double > mReassignedTimes;
+	std::vector< double > mReassignedMags;
 		
 };	//	end of class ReassignedSpectrum
 
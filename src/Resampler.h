@@ -40,6 +40,8 @@
 #include "PartialList.h"
 #include "LinearEnvelope.h"
 
+#include <vector>
+
 //	begin namespace
 namespace Loris {
 
@@ -154,6 +156,21 @@ public:
     //!
     //! \param  p is the Partial to resample
     void quantize( Partial & p ) const;
+    
+    //! Quantize the Breakpoint times of the specified Partial exactly as
+    //! quantize( Partial & ) does, but without modifying or copying the 
+    //! Partial, storing the times and the quantized Breakpoints in the
+    //! specified vectors (replacing their contents) instead. Reusing the 
+    //! same vectors to quantize many Partials avoids allocating storage
+    //! for each one.
+    //!
+    //! \param  p is the Partial to quantize
+    //! \param  times is the vector in which to store the quantized 
+    //!         Breakpoint times
+    //! \param  breakpoints is the vector in which to store the quantized
+    //!         Breakpoints, one for each time
+    void quantize( const Partial & p, std::vector< double > & times,
+                   std::vector< Breakpoint > & breakpoints ) const;
 
 //	--- resampling PartialLists ---
 
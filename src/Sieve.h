@@ -73,6 +73,10 @@ class Sieve
     double _fadeTime; //! extra time (in seconds) added to each end of 
                       //! a Partial when determining overlap, to accomodate 
                       //! the fade to and from zero amplitude.
+                      
+    unsigned int _numThreads; //! number of threads used to sift groups of 
+                              //! Partials having a common label, or 0 for
+                              //! one thread per available processor.
     
 //  -- public interface --
 public:
@@ -112,6 +116,23 @@ public:
      
     //  Use compiler-generated copy, assign, and destroy.
     
+//  -- access/mutation --
+
+    //! Return the number of threads used to sift groups of Partials
+    //! having a common label, or 0 if one thread per available processor
+    //! is used. (Default is 1, serial sifting.)
+    unsigned int numThreads( void ) const;
+    
+    //! Set the number of threads used to sift groups of Partials
+    //! having a common label. The groups are independent, so they are
+    //! sifted concurrently, and the sifted Partials are exactly the 
+    //! same as when a single thread is used. (Default is 1, serial 
+    //! sifting.)
+    //!
+    //! \param  n is the number of threads to use, or 0 to use
+    //!         one thread per available processor.
+    void setNumThreads( unsigned int n );
+    
 //  -- sifting --
 
     //! Sift labeled Partials on the specified half-open (STL-style)
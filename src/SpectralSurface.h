@@ -36,9 +36,11 @@
  *
  */
 
+#include "LinearEnvelope.h"
 #include "LorisExceptions.h"
 #include "Partial.h"
 #include "PartialList.h"
+#include "PartialPtrs.h"
 #include "PartialUtils.h"   // for compareLabelLess
 
 #include <algorithm>        // for sort
@@ -88,7 +90,7 @@ public:
     //! at the corresponding time and frequency.
     //!
     //! \param  p the Partial to modify
-	void scaleAmplitudes( Partial & p );
+	void scaleAmplitudes( Partial & p ) const;
 
 	//! Scale the amplitudes of a sequence of Partials
     //! according to the amplitude of the spectral surface
@@ -110,10 +112,10 @@ public:
     //!	of iterators over a sequence of Partials.
 #if ! defined(NO_TEMPLATE_MEMBERS)
 	template<typename Iter>
-    void scaleAmplitudes( Iter b, Iter e );
+    void scaleAmplitudes( Iter b, Iter e ) const;
 #else
     inline
-	void scaleAmplitudes( PartialList::iterator b, PartialList::iterator e );
+	void scaleAmplitudes( PartialList::iterator b, PartialList::iterator e ) const;
 #endif
     
 	//! Set the amplitude of every Breakpoint in a Partial
@@ -121,7 +123,7 @@ public:
     //! at the corresponding time and frequency.
     //!
     //! \param  p the Partial to modify
-	void setAmplitudes( Partial & p );
+	void setAmplitudes( Partial & p ) const;
     
 	//! Set the amplitudes of a sequence of Partials
     //! equal to the amplitude of the spectral surface
@@ -145,10 +147,10 @@ public:
     //!	of iterators over a sequence of Partials.
 #if ! defined(NO_TEMPLATE_MEMBERS)
 	template<typename Iter>
-    void setAmplitudes( Iter b, Iter e );
+    void setAmplitudes( Iter b, Iter e ) const;
 #else
     inline
-	void setAmplitudes( PartialList::iterator b, PartialList::iterator e );
+	void setAmplitudes( PartialList::iterator b, PartialList::iterator e ) const;
 #endif
 	
 // --- access/mutation ---
@@ -175,6 +177,11 @@ public:
     //! amount of the effect.)
 	double effect( void ) const;
 	
+    //! Return the number of threads used to apply this surface
+    //! to a sequence of Partials, or 0 if one thread per available
+    //! processor is used. (Default is 1, serial application.)
+    unsigned int numThreads( void ) const;
+	
     //! Set the amount of strecthing in the frequency dimension
     //! (default 1, no stretching). Values greater than 1 stretch
     //! the surface in the frequency dimension, values less than 1
@@ -208,12 +215,26 @@ public:
     //!         and setAmplitudes
 	void setEffect( double effect );
 	
+    //! Set the number of threads used to apply this surface to
+    //! a sequence of Partials. Each Partial is modified independently
+    //! of the others, so the Partials are modified concurrently, 
+    //! with exactly the same results as when a single thread is 
+    //! used. (Default is 1, serial application.)
+    //!
+    //! \param  n is the number of threads to use, or 0 to use
+    //!         one thread per available processor.
+	void setNumThreads( unsigned int n );
+	
 private:
 
 //	-- instance variables --
 
 	std::vector< Partial > mPartials;   //! the Partials comprising the surface are
                                         //! stored in a vector for easy random access
+	std::vector< LinearEnvelope > mSmoothedAmps; 
+	                                    //! the smoothed amplitude of each surface Partial,
+	                                    //! used where the Partial amplitude is zero,
+	                                    //! parallel to mPartials
 	double mStretchFreq;                //! stretch factor for the frequency dimension
     double mStretchTime;                //! stretch factor for the time dimension
     double mEffect;                     //! factor for controlling the amount of
@@ -223,12 +244,24 @@ private:
     double mMaxSurfaceAmp;              //! the maximum amplitude of any Breakpoint on 
                                         //! the surface, used for normalizing the surface
                                         //! amplitude for scaleAmplitudes
+    unsigned int mNumThreads;           //! number of threads used to apply the surface
+                                        //! to a sequence of Partials, 0 for one per
+                                        //! available processor
     
 // --- private helpers ---
 
     //  helper used by constructor for adding Partials one by one
     void addPartialAux( const Partial & p );
     
+    //  helper used by constructor for precomputing the smoothed 
+    //  amplitudes of the Partials, after they are sorted
+    void smoothAmplitudes( void );
+    
+    //  helpers used by the template members for modifying a 
+    //  collection of pointers to Partials, possibly in parallel
+    void scaleAmplitudes_ptrs( PartialPtrs & ptrs ) const;
+    void setAmplitudes_ptrs( PartialPtrs & ptrs ) const;
+    
 };
 
 // ---------------------------------------------------------------------------
@@ -256,7 +289,8 @@ SpectralSurface::SpectralSurface( PartialList::iterator b,
 	mStretchFreq( 1.0 ),
 	mStretchTime( 1.0 ),
 	mEffect( 1.0 ),
-    mMaxSurfaceAmp( 0.0 )
+    mMaxSurfaceAmp( 0.0 ),
+    mNumThreads( 1 )
 {
     //  add only labeled Partials:
     while ( b != e )
@@ -281,6 +315,8 @@ SpectralSurface::SpectralSurface( PartialList::iterator b,
 	
 	// sort by label
 	std::sort( mPartials.begin(), mPartials.end(), PartialUtils::compareLabelLess() );
+	
+	smoothAmplitudes();
 }
 
 
@@ -308,18 +344,16 @@ SpectralSurface::SpectralSurface( PartialList::iterator b,
 //
 #if ! defined(NO_TEMPLATE_MEMBERS)
 template<typename Iter>
-void SpectralSurface::scaleAmplitudes( Iter b, Iter e )
+void SpectralSurface::scaleAmplitudes( Iter b, Iter e ) const
 #else
 inline
 void SpectralSurface::scaleAmplitudes( PartialList::iterator b, 
-                                       PartialList::iterator e )
+                                       PartialList::iterator e ) const
 #endif
 {	
-	while ( b != e )
-	{
-        scaleAmplitudes( *b );
-        ++b;
-	}	
+    PartialPtrs ptrs;
+    fillPartialPtrs( b, e, ptrs );
+    scaleAmplitudes_ptrs( ptrs );
 }
 
 // ---------------------------------------------------------------------------
@@ -348,18 +382,16 @@ void SpectralSurface::scaleAmplitudes( PartialList::iterator b,
 //
 #if ! defined(NO_TEMPLATE_MEMBERS)
 template<typename Iter>
-void SpectralSurface::setAmplitudes( Iter b, Iter e )
+void SpectralSurface::setAmplitudes( Iter b, Iter e ) const
 #else
 inline
 void SpectralSurface::setAmplitudes( PartialList::iterator b, 
-                                     PartialList::iterator e )
+                                     PartialList::iterator e ) const
 #endif
 {	
-	while ( b != e )
-	{
-        setAmplitudes( *b );
-        ++b;
-	}	
+    PartialPtrs ptrs;
+    fillPartialPtrs( b, e, ptrs );
+    setAmplitudes_ptrs( ptrs );
 }
 
 }	// namespace Loris
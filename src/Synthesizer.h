@@ -159,7 +159,7 @@ public:
 	//!         resized to accommodate the entire duration of the 
 	//!         Partial, p, including fade out at the end.
 	//!	\throw	InvalidPartial if the Partial has negative start time.
-	void synthesize( Partial p );	
+	void synthesize( const Partial & p );	
 	 
 	//!	Function call operator: same as synthesize( p ).
 	void operator() ( const Partial & p ) { synthesize( p ) ; }
@@ -243,6 +243,88 @@ public:
 	//! synthesis. (Can use this access to make changes to the
 	//! filter coefficients.)
 	Filter & filter( void );
+
+	//!	Return true if this Synthesizer renders Partials using an 
+	//!	OscillatorBank, which renders many Partials concurrently
+	//!	and computes cosines using a fast polynomial approximation,
+	//!	and false (the default) if it renders Partials one at a time
+	//!	using a single Oscillator.
+	bool usesOscillatorBank( void ) const;
+
+	//!	Specify whether this Synthesizer should render Partials using
+	//!	an OscillatorBank. Rendering using an OscillatorBank is much
+	//!	faster, particularly when many Partials are synthesized by a
+	//!	single call to synthesize. The rendered samples differ from 
+	//!	those rendered by a single Oscillator by at most 
+	//!	OscillatorBank::FastCosMaxError times the sum of the Partial
+	//!	amplitudes, except for the (random) bandwidth-enhancement 
+	//!	noise, which is different, but has the same statistics.
+	//!
+	//!	\param	useBank is true to render using an OscillatorBank,
+	//!			and false to render using a single Oscillator.
+	void setUseOscillatorBank( bool useBank );
+
+	//!	Return true if this Synthesizer renders Partials in single 
+	//!	precision when it uses an OscillatorBank, and false (the 
+	//!	default) if it always renders in double precision.
+	bool usesSinglePrecision( void ) const;
+
+	//!	Specify whether this Synthesizer should render Partials in 
+	//!	single precision when it uses an OscillatorBank (see 
+	//!	setUseOscillatorBank). The OscillatorBank then stores and sums
+	//!	samples in single precision, which is faster, but the phases
+	//!	are accumulated in double precision (see OscillatorBank). The
+	//!	rendered samples differ from those rendered in double precision
+	//!	by at most about OscillatorBank::FastCosfMaxError times the sum
+	//!	of the Partial amplitudes. Has no effect on rendering using a 
+	//!	single Oscillator. Only the rendering is affected: the Breakpoint
+	//!	parameters and the sample buffer are always double precision,
+	//!	and analysis (see Analyzer) is always performed in double
+	//!	precision.
+	//!
+	//!	\param	single is true to render in single precision, and false
+	//!			to render in double precision.
+	void setUseSinglePrecision( bool single );
+
+	//!	Return the number of threads used to render a range of Partials,
+	//!	or 0 if one thread per available processor is used. (Default is 1,
+	//!	serial rendering.)
+	unsigned int numThreads( void ) const;
+
+	//!	Set the number of threads used to render a range of Partials.
+	//!	The Partials are divided into groups, one for each thread, and
+	//!	each thread renders a group into its own buffer. The buffers are
+	//!	then summed, always in the same order, into the sample buffer.
+	//!
+	//!	When a number of threads other than 1 is specified, or when an
+	//!	OscillatorBank is used, the bandwidth-enhancement noise for each
+	//!	Partial is generated from its own noise stream, numbered in the
+	//!	order in which the Partials are rendered by this Synthesizer, 
+	//!	instead of from a single noise generator shared by all Partials.
+	//!	Then the rendered samples are reproducible, and identical for 
+	//!	any given number of threads. (Default is 1, serial rendering.)
+	//!
+	//!	\param	n is the number of threads to use, or 0 to use
+	//!			one thread per available processor.
+	void setNumThreads( unsigned int n );
+	
+	//!	Return the algorithm used to generate the bandwidth-enhancement
+	//!	noise (default is NoiseGenerator::ParkMiller).
+	NoiseGenerator::Algorithm noiseAlgorithm( void ) const;
+	
+	//!	Select the algorithm used to generate the bandwidth-enhancement
+	//!	noise. NoiseGenerator::Counter is much faster than the default,
+	//!	NoiseGenerator::ParkMiller, but generates different noise (see
+	//!	NoiseGenerator::Algorithm), so ParkMiller must be used to reproduce
+	//!	exactly the samples rendered by earlier versions of Loris. 
+	//!	The noise generated by ParkMiller has a variance of about 0.89,
+	//!	instead of 1, so the noise rendered using Counter is about
+	//!	0.5 dB louder. Using either algorithm, the noise for each 
+	//!	Partial can be generated from its own noise stream (see 
+	//!	setNumThreads).
+	//!
+	//!	\param	alg is the algorithm used to generate noise
+	void setNoiseAlgorithm( NoiseGenerator::Algorithm alg );
 	
 
 //	-- parameters structure --
@@ -312,6 +394,22 @@ private:
 	
 	double m_fadeTimeSec;               	//  Partial fade in/out time in seconds
 	double m_srateHz;                     	//	sample rate in Hz
+	
+	bool m_useBank;                         //  render using an OscillatorBank
+	bool m_singlePrecision;                 //  OscillatorBank renders in single
+	                                        //  precision
+	unsigned int m_numThreads;              //  threads used to render Partials,
+	                                        //  0 for one per processor
+	unsigned long m_noiseStream;            //  noise stream index for the next
+	                                        //  Partial rendered with its own noise
+	
+	//	Render the Partials using an OscillatorBank, or several
+	//	threads, or both.
+	void synthesizeRange( const std::vector< const Partial * > & partials );
+	
+	std::vector< double > m_times;          //  quantized Breakpoint times and
+	std::vector< Breakpoint > m_breakpoints;//  Breakpoints of the Partial being
+	                                        //  rendered, reused for every Partial
 		
 };	//	end of class Synthesizer
 
@@ -361,6 +459,18 @@ Synthesizer::synthesize( PartialList::const_iterator begin_partials,
         m_sampleBuffer->resize( Nsamps );
     }
     
+    if ( m_useBank || 1 != m_numThreads )
+    {
+        //  render many Partials concurrently:
+        std::vector< const Partial * > partials;
+        while ( begin_partials != end_partials ) 
+        {
+            partials.push_back( &( *(begin_partials++) ) );
+        }
+        synthesizeRange( partials );
+        return;
+    }
+    
     while ( begin_partials != end_partials ) 
     {
         synthesize( *(begin_partials++) ); 
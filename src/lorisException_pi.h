@@ -69,6 +69,8 @@ class NullPointer : public Loris::Exception
 public: 
 	NullPointer( const std::string & str, const std::string & where = "" ) : 
 		Exception( std::string("NULL pointer exception -- ").append( str ), where ) {}
+	NullPointer * clone( void ) const { return new NullPointer( *this ); }
+	void raise( void ) const { throw *this; }
 };	//	end of class NullPointer
 
 #define ThrowIfNull(ptr) if ((ptr)==NULL) Throw( NullPointer, #ptr );	
@@ -0,0 +1,76 @@
+#ifndef INCLUDE_IDENTICAL_PARTIALS_H
+#define INCLUDE_IDENTICAL_PARTIALS_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ *  identical_partials.h
+ *
+ *  Comparison of collections of Partials, shared by the unit tests
+ *  that verify that several threads produce exactly the same Partials
+ *  as one.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "Partial.h"
+#include "PartialList.h"
+
+// ----------- identical_partials -----------
+//
+//	Return true if the two lists have the same Partials, in the same
+//	order, with exactly the same labels and Breakpoints.
+//
+static bool identical_partials( const Loris::PartialList & l1,
+                                const Loris::PartialList & l2 )
+{
+    if ( l1.size() != l2.size() )
+    {
+        return false;
+    }
+    Loris::PartialList::const_iterator p1 = l1.begin(), p2 = l2.begin();
+    for ( ; p1 != l1.end(); ++p1, ++p2 )
+    {
+        if ( p1->label() != p2->label() ||
+             p1->numBreakpoints() != p2->numBreakpoints() )
+        {
+            return false;
+        }
+        Loris::Partial::const_iterator b1 = p1->begin(), b2 = p2->begin();
+        for ( ; b1 != p1->end(); ++b1, ++b2 )
+        {
+            if ( b1.time() != b2.time() ||
+                 b1->frequency() != b2->frequency() ||
+                 b1->amplitude() != b2->amplitude() ||
+                 b1->bandwidth() != b2->bandwidth() ||
+                 b1->phase() != b2->phase() )
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+#endif /* ndef INCLUDE_IDENTICAL_PARTIALS_H */
@@ -1,5 +1,3 @@
-#ifndef INCLUDE_LORIS_H
-#define INCLUDE_LORIS_H
 /*
  * This is the Loris C++ Class Library, implementing analysis, 
  * manipulation, and synthesis of digitized sounds using the Reassigned 
@@ -50,11 +48,31 @@
  * http://www.cerlsoundgroup.org/Loris/
  *
  */
+
+/*  Configuration
+
+    LORIS_PARTIAL_MAP is 1 if Loris was configured to store the
+    Breakpoints in a Partial in a std::map instead of a std::vector.
+    The two containers give Partial different layouts, so code using
+    Loris must agree with the library. Partial.h includes only this
+    section of loris.h, by defining LORIS_CONFIGURATION_ONLY, to make
+    sure that it does. The windows projects build Loris using the 
+    default, std::vector; change this to 1 to build using std::map.
+ */
+#ifndef INCLUDE_LORIS_CONFIGURATION_H
+#define INCLUDE_LORIS_CONFIGURATION_H
+
+#define LORIS_PARTIAL_MAP 0
+
+#endif    /* ndef INCLUDE_LORIS_CONFIGURATION_H */
+
+#if !defined(INCLUDE_LORIS_H) && !defined(LORIS_CONFIGURATION_ONLY)
+#define INCLUDE_LORIS_H
  
 /* ---------------------------------------------------------------- */
 /*      Version
-/*
-/*  Define symbols that facilitate version/release identification.
+ *
+ *  Define symbols that facilitate version/release identification.
  */
  
 #define LORIS_MAJOR_VERSION 1
@@ -64,8 +82,8 @@
 
 /* ---------------------------------------------------------------- */
 /*      Types
-/*
-/* The (class) types Breakpoint, LinearEnvelope, Partial, 
+ *
+ * The (class) types Breakpoint, LinearEnvelope, Partial, 
    and PartialList are imported from the Loris namespace.
    The first three are classes, the latter is a typedef
    for std::list< Loris::Partial >. 
@@ -113,8 +131,8 @@
 
 /* ---------------------------------------------------------------- */
 /*      Analyzer configuration
-/*
-/*  An Analyzer represents a configuration of parameters for
+ *
+ *  An Analyzer represents a configuration of parameters for
     performing Reassigned Bandwidth-Enhanced Additive Analysis
     of sampled waveforms. This analysis process yields a collection 
     of Partials, each having a trio of synchronous, non-uniformly-
@@ -296,8 +314,8 @@ double analyzer_getBwConvergenceTolerance( void );
 
 /* ---------------------------------------------------------------- */
 /*      LinearEnvelope object interface                                
-/*
-/*  A LinearEnvelope represents a linear segment breakpoint 
+ *
+ *  A LinearEnvelope represents a linear segment breakpoint 
     function with infinite extension at each end (that is, the 
     values past either end of the breakpoint function have the 
     values at the nearest end).
@@ -337,8 +355,8 @@ double linearEnvelope_valueAt( const LinearEnvelope * ptr_this,
 
 /* ---------------------------------------------------------------- */
 /*      PartialList object interface
-/*
-/*  A PartialList represents a collection of Bandwidth-Enhanced 
+ *
+ *  A PartialList represents a collection of Bandwidth-Enhanced 
     Partials, each having a trio of synchronous, non-uniformly-
     sampled breakpoint envelopes representing the time-varying 
     frequency, amplitude, and noisiness of a single bandwidth-
@@ -382,8 +400,8 @@ void partialList_splice( PartialList * ptr_this,
  
 /* ---------------------------------------------------------------- */
 /*      Partial object interface
-/*
-/*  A Partial represents a single component in the
+ *
+ *  A Partial represents a single component in the
     reassigned bandwidth-enhanced additive model. A Partial consists of a
     chain of Breakpoints describing the time-varying frequency, amplitude,
     and bandwidth (or noisiness) envelopes of the component, and a 4-byte
@@ -448,8 +466,8 @@ void partial_setLabel( Partial * p, int label );
 
 /* ---------------------------------------------------------------- */
 /*      Breakpoint object interface
-/*
-/*  A Breakpoint represents a single breakpoint in the
+ *
+ *  A Breakpoint represents a single breakpoint in the
     Partial parameter (frequency, amplitude, bandwidth) envelope.
     Instantaneous phase is also stored, but is only used at the onset of 
     a partial, or when it makes a transition from zero to nonzero amplitude.
@@ -497,8 +515,8 @@ void breakpoint_setPhase( Breakpoint * bp, double phi );
 
 /* ---------------------------------------------------------------- */
 /*      non-object-based procedures
-/*
-/*  Operations in Loris that need not be accessed though object
+ *
+ *  Operations in Loris that need not be accessed though object
     interfaces are represented as simple functions.
  */
 
@@ -767,8 +785,8 @@ synthesize( const PartialList * partials,
 
 /* ---------------------------------------------------------------- */
 /*      utility functions
-/*
-/*  Operations for transforming and manipulating collections
+ *
+ *  Operations for transforming and manipulating collections
     of Partials.
  */
 
@@ -997,8 +1015,8 @@ double weightedAvgFrequency( const Partial * p );
  
 /* ---------------------------------------------------------------- */
 /*      Notification and exception handlers                            
-/*
-/*  An exception handler and a notifier may be specified. Both 
+ *
+ *  An exception handler and a notifier may be specified. Both 
     are functions taking a const char * argument and returning
     void.
  */